@@ -130,6 +130,7 @@ void QFile::init()
     length = 0;
     ioIndex = 0;
     ext_f  = FALSE;				// not an external file handle
+    wbuf   = 0;
 }
 
 
@@ -400,7 +401,7 @@ int QFile::putch( int ch )
 	buf[0] = ch;
 	ch = writeBlock( buf, 1 ) == 1 ? ch : EOF;
     } else {					// buffered file
-	if ( (ch = putc( ch, fh )) != EOF ) {
+	if ( (ch = (ext_f ? putc( ch, fh ) : PUTC( ch, fh ))) != EOF ) {
 	    ioIndex++;
 	    if ( ioIndex > length )		// update file length
 		length = ioIndex;
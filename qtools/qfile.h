@@ -104,6 +104,7 @@ protected:
     int		fd;
     int		length;
     bool	ext_f;
+    char       *wbuf;				// stdio buffer of a file opened for writing
     void * 	d;
 
 private:
@@ -239,6 +239,10 @@ bool QFile::open( int m )
 	}
 	if ( fh ) {
 	    FSTAT( FILENO(fh), &st ); // get the stat for later usage
+	    if ( isWritable() ) {		// write the output in large blocks
+		wbuf = new char[QFILE_WRITE_BUFSIZE];
+		setvbuf( fh, wbuf, _IOFBF, QFILE_WRITE_BUFSIZE );
+	    }
 	} else {
 	    ok = FALSE;
 	}
@@ -555,7 +559,7 @@ int QFile::writeBlock( const char *p, uint len )
     if ( isRaw() )				// raw file
 	nwritten = (int)WRITE( fd, p, len );
     else					// buffered file
-	nwritten = (int)fwrite( p, 1, len, fh );
+	nwritten = (int)(ext_f ? fwrite( p, 1, len, fh ) : FWRITE( p, 1, len, fh ));
     if ( nwritten != (int)len ) {		// write error
 	if ( errno == ENOSPC )			// disk is full
 	    setStatus( IO_ResourceError );
@@ -620,6 +624,7 @@ void QFile::close()
 		ok = fflush( fh ) != -1;	// flush instead of closing
 	    else
 		ok = fclose( fh ) != -1;
+	    delete [] wbuf;			// only in use until fclose()
 	} else {				// raw file
 	    if ( ext_f )
 		ok = TRUE;			// cannot close
@@ -235,6 +235,25 @@
 # endif
 #endif
 
+// A QFile that opened its own FILE is not shared with other threads, so
+// the per call locking of putc() and fwrite() can be skipped for it.
+#undef PUTC
+#undef FWRITE
+#if defined(__GLIBC__)
+# define PUTC		putc_unlocked
+# define FWRITE		fwrite_unlocked
+#elif defined(_OS_UNIX_) && !defined(_OS_CYGWIN_)
+# define PUTC		putc_unlocked
+# define FWRITE		fwrite
+#else
+# define PUTC		putc
+# define FWRITE		fwrite
+#endif
+
+// size of the stdio buffer of files opened for writing, the generated
+// output is written in blocks of this size instead of the default
+#define QFILE_WRITE_BUFSIZE 65536
+
 #if defined(_CC_MWERKS_)
 #undef mkdir
 #undef MKDIR
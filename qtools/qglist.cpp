@@ -885,50 +885,53 @@ void QGList::toVector( QGVector *vector ) const
     }
 }
 
-void QGList::heapSortPushDown( QCollection::Item* heap, int first, int last )
+/*!
+  \internal
+  Sorts the \a n items in \a items, using \a tmp (of the same size) as
+  scratch space. Short runs are sorted by insertion, which is faster than
+  merging for a handful of items.
+*/
+
+void QGList::mergeSort( QCollection::Item* items, QCollection::Item* tmp, uint n )
 {
-    int r = first;
-    while( r <= last/2 ) {
-	// Node r has only one child ?
-	if ( last == 2*r ) {
-	    // Need for swapping ?
-	    if ( compareItems( heap[r], heap[ 2*r ] ) > 0 ) {
-		QCollection::Item tmp = heap[r];
-		heap[ r ] = heap[ 2*r ];
-		heap[ 2*r ] = tmp;
-	    }
-	    // That's it ...
-	    r = last;
-	} else {
-	    // Node has two children
-	    if ( compareItems( heap[r], heap[ 2*r ] ) > 0 &&
-		 compareItems( heap[ 2*r ], heap[ 2*r+1 ] ) <= 0 ) {
-		// Swap with left child
-		QCollection::Item tmp = heap[r];
-		heap[ r ] = heap[ 2*r ];
-		heap[ 2*r ] = tmp;
-		r *= 2;
-	    } else if ( compareItems( heap[r], heap[ 2*r+1 ] ) > 0 &&
-			compareItems( heap[ 2*r+1 ], heap[ 2*r ] ) < 0 ) {
-		// Swap with right child
-		QCollection::Item tmp = heap[r];
-		heap[ r ] = heap[ 2*r+1 ];
-		heap[ 2*r+1 ] = tmp;
-		r = 2*r+1;
-	    } else {
-		// We are done
-		r = last;
+    if ( n <= 8 ) {
+	for ( uint i = 1; i < n; i++ ) {
+	    QCollection::Item d = items[i];
+	    uint j = i;
+	    while ( j > 0 && compareItems( items[j-1], d ) > 0 ) {
+		items[j] = items[j-1];
+		j--;
 	    }
+	    items[j] = d;
 	}
+	return;
     }
+    uint half = n / 2;
+    mergeSort( items, tmp, half );
+    mergeSort( items + half, tmp + half, n - half );
+    if ( compareItems( items[half-1], items[half] ) <= 0 )
+	return;					// already in order
+    memcpy( tmp, items, n * sizeof(QCollection::Item) );
+    uint i = 0, j = half, k = 0;
+    while ( i < half && j < n ) {
+	if ( compareItems( tmp[j], tmp[i] ) < 0 )
+	    items[k++] = tmp[j++];
+	else
+	    items[k++] = tmp[i++];		// equal items keep their order
+    }
+    while ( i < half )
+	items[k++] = tmp[i++];
+    while ( j < n )
+	items[k++] = tmp[j++];
 }
 
 
 /*! Sorts the list by the result of the virtual compareItems() function.
 
-  The Heap-Sort algorithm is used for sorting.  It sorts n items with
-  O(n*log n) compares.  This is the asymptotic optimal solution of the
-  sorting problem.
+  The Merge-Sort algorithm is used for sorting.  It sorts n items with
+  O(n*log n) compares, and items that compare equal keep their relative
+  order.  The items are sorted in an array and then stored back in the
+  nodes, so the list itself is not relinked.
 */
 
 void QGList::sort()
@@ -937,35 +940,19 @@ void QGList::sort()
     if ( n < 2 )
 	return;
 
-    // Create the heap
-    QCollection::Item* realheap = new QCollection::Item[ n ];
-    // Wow, what a fake. But I want the heap to be indexed as 1...n
-    QCollection::Item* heap = realheap - 1;
-    int size = 0;
-    QLNode* insert = firstNode;
-    for( ; insert != 0; insert = insert->next ) {
-	heap[++size] = insert->data;
-	int i = size;
-	while( i > 1 && compareItems( heap[i], heap[ i / 2 ] ) < 0 ) {
-	    QCollection::Item tmp = heap[ i ];
-	    heap[ i ] = heap[ i/2 ];
-	    heap[ i/2 ] = tmp;
-	    i /= 2;
-	}
-    }
+    QCollection::Item* items = new QCollection::Item[ 2*n ];
+    uint i = 0;
+    QLNode* node = firstNode;
+    for( ; node != 0; node = node->next )
+	items[i++] = node->data;
 
-    insert = firstNode;
-    // Now do the sorting
-    for ( int i = n; i > 0; i-- ) {
-	insert->data = heap[1];
-	insert = insert->next;
-	if ( i > 1 ) {
-	    heap[1] = heap[i];
-	    heapSortPushDown( heap, 1, i - 1 );
-	}
-    }
+    mergeSort( items, items + n, n );
+
+    i = 0;
+    for( node = firstNode; node != 0; node = node->next )
+	node->data = items[i++];
 
-    delete [] realheap;
+    delete [] items;
 }
 
 
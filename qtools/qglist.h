@@ -133,7 +133,7 @@ protected:
 private:
     void  prepend( QCollection::Item ); // add item at start of list
 
-    void heapSortPushDown( QCollection::Item* heap, int first, int last );
+    void mergeSort( QCollection::Item* items, QCollection::Item* tmp, uint n );
 
     QLNode *firstNode;				// first node
     QLNode *lastNode;				// last node
@@ -318,6 +318,7 @@ ClassDef::ClassDef(
 // destroy the class definition
 ClassDef::~ClassDef()
 {
+  clearClassDistanceCache();
   delete m_impl;
 }
 
@@ -384,6 +385,7 @@ void ClassDef::insertBaseClass(ClassDef *cd,const char *n,Protection p,
   }
   m_impl->inherits->append(new BaseClassDef(cd,n,p,s,t));
   m_impl->isSimple = FALSE;
+  clearClassDistanceCache();
 }
 
 // inserts a derived/sub class in the inherited-by list
@@ -1956,7 +1958,7 @@ void ClassDef::writeDeclarationLink(OutputList &ol,bool &found,const char *heade
     // add the brief description if available
     if (!briefDescription().isEmpty() && Config_getBool(BRIEF_MEMBER_DESC))
     {
-      DocRoot *rootNode = validatingParseDoc(briefFile(),briefLine(),this,0,
+      DocRoot *rootNode = validatingParseDocCached(briefFile(),briefLine(),this,0,
                                 briefDescription(),FALSE,FALSE,0,TRUE,FALSE);
       if (rootNode && !rootNode->isEmpty())
       {
@@ -1982,7 +1984,7 @@ void ClassDef::writeDeclarationLink(OutputList &ol,bool &found,const char *heade
         }
         ol.endMemberDescription();
       }
-      delete rootNode;
+      releaseParsedDoc(rootNode);
     }
     ol.endMemberDeclaration(anchor(),0);
   }
@@ -4603,6 +4605,7 @@ void ClassDef::makeTemplateArgument(bool b)
 void ClassDef::setCategoryOf(ClassDef *cd)
 {
   m_impl->categoryOf = cd;
+  clearClassDistanceCache();
 }
 
 void ClassDef::setUsedOnly(bool b)
@@ -1243,7 +1243,7 @@ static TemplateVariant parseDoc(Definition *def,const QCString &file,int line,
                                 const QCString &relPath,const QCString &docStr,bool isBrief)
 {
   TemplateVariant result;
-  DocRoot *root = validatingParseDoc(file,line,def,0,docStr,TRUE,FALSE,0,isBrief,FALSE);
+  DocRoot *root = validatingParseDocCached(file,line,def,0,docStr,TRUE,FALSE,0,isBrief,FALSE);
   QGString docs;
   {
     FTextStream ts(&docs);
@@ -1274,7 +1274,7 @@ static TemplateVariant parseDoc(Definition *def,const QCString &file,int line,
     result = "";
   else
     result = TemplateVariant(docs,TRUE);
-  delete root;
+  releaseParsedDoc(root);
   return result;
 }
 
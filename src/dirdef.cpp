@@ -172,7 +172,7 @@ void DirDef::writeBriefDescription(OutputList &ol)
 {
   if (hasBriefDescription())
   {
-    DocRoot *rootNode = validatingParseDoc(
+    DocRoot *rootNode = validatingParseDocCached(
          briefFile(),briefLine(),this,0,briefDescription(),TRUE,FALSE);
     if (rootNode && !rootNode->isEmpty())
     {
@@ -200,7 +200,7 @@ void DirDef::writeBriefDescription(OutputList &ol)
 
       ol.endParagraph();
     }
-    delete rootNode;
+    releaseParsedDoc(rootNode);
   }
   ol.writeSynopsis();
 }
@@ -334,7 +334,7 @@ static void writeDocbookDocBlock(FTextStream &t,
   QCString stext = text.stripWhiteSpace();
   if (stext.isEmpty()) return;
   // convert the documentation string into an abstract syntax tree
-  DocNode *root = validatingParseDoc(fileName,lineNr,scope,md,text,FALSE,FALSE);
+  DocNode *root = validatingParseDocCached(fileName,lineNr,scope,md,text,FALSE,FALSE);
   // create a code generator
   DocbookCodeGenerator *docbookCodeGen = new DocbookCodeGenerator(t);
   // create a parse tree visitor for Docbook
@@ -344,7 +344,7 @@ static void writeDocbookDocBlock(FTextStream &t,
   // clean up
   delete visitor;
   delete docbookCodeGen;
-  delete root;
+  releaseParsedDoc(root);
 }
 
 void writeDocbookCodeBlock(FTextStream &t,FileDef *fd)
@@ -352,7 +352,7 @@ void DocbookDocVisitor::visit(DocInclude *inc)
       Doxygen::parserManager->getParser(inc->extension())
         ->parseCode(m_ci,
             inc->context(),
-            extractBlock(inc->text(),inc->blockId()),
+            inc->blockText(),
             langExt,
             inc->isExample(),
             inc->exampleFile()
@@ -367,12 +367,12 @@ void DocbookDocVisitor::visit(DocInclude *inc)
          Doxygen::parserManager->getParser(inc->extension())
                                ->parseCode(m_ci,
                                            inc->context(),
-                                           extractBlock(inc->text(),inc->blockId()),
+                                           inc->blockText(),
                                            langExt,
                                            inc->isExample(),
                                            inc->exampleFile(), 
                                            &fd,
-                                           lineBlock(inc->text(),inc->blockId()),
+                                           inc->blockLine(),
                                            -1,    // endLine
                                            FALSE, // inlineFragment
                                            0,     // memberDef
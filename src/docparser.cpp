@@ -24,7 +24,9 @@
 #include <qcstring.h>
 #include <qstack.h>
 #include <qdict.h>
+#include <qptrdict.h>
 #include <qregexp.h>
+#include <qcache.h>
 #include <ctype.h>
 
 #include "doxygen.h"
@@ -82,38 +84,17 @@ static const char *sectionLevelToName[] =
 
 //---------------------------------------------------------------------------
 
-// Parser state: global variables during a call to validatingParseDoc
-static Definition *           g_scope;
-static QCString               g_context;
-static bool                   g_inSeeBlock;
-static bool                   g_xmlComment;
-static bool                   g_insideHtmlLink;
-static QStack<DocNode>        g_nodeStack;
-static QStack<DocStyleChange> g_styleStack;
-static QStack<DocStyleChange> g_initialStyleStack;
-static QList<Definition>      g_copyStack;
-static QCString               g_fileName;
-static QCString               g_relPath;
-
-static bool                   g_hasParamCommand;
-static bool                   g_hasReturnCommand;
-static QDict<void>            g_paramsFound;
-static MemberDef *            g_memberDef;
-static bool                   g_isExample;
-static QCString               g_exampleName;
-static SectionDict *          g_sectionDict;
-static QCString               g_searchUrl;
-
-static QCString               g_includeFileName;
-static QCString               g_includeFileText;
-static uint                   g_includeFileOffset;
-static uint                   g_includeFileLength;
-
-
-/** Parser's context to store all global variables. 
+/** Parser's context to store all state needed during a call to
+ *  validatingParseDoc(). The state of the current call is pointed to by
+ *  g_ctx; the contexts of the calls it interrupted are on g_parserStack.
  */
 struct DocParserContext
 {
+  DocParserContext() : scope(0), inSeeBlock(FALSE), xmlComment(FALSE),
+                       insideHtmlLink(FALSE), lineNo(0),
+                       hasParamCommand(FALSE), hasReturnCommand(FALSE),
+                       memberDef(0), isExample(FALSE), sectionDict(0),
+                       includeFileOffset(0), includeFileLength(0), token(0) {}
   Definition *scope;
   QCString context;
   bool inSeeBlock;
@@ -136,6 +117,7 @@ struct DocParserContext
   SectionDict *sectionDict;
   QCString     searchUrl;
 
+  QCString  includeFileName;
   QCString  includeFileText;
   uint     includeFileOffset;
   uint     includeFileLength;
@@ -143,94 +125,156 @@ struct DocParserContext
   TokenInfo *token;
 };
 
+static DocParserContext         g_initialContext;
+static DocParserContext *       g_ctx = &g_initialContext;
 static QStack<DocParserContext> g_parserStack;
 
 //---------------------------------------------------------------------------
-static void docParserPushContext(bool saveParamInfo=TRUE)
+/*! Starts a nested parse. The nested parse starts with a copy of the
+ *  current state, and gets a token of its own.
+ */
+static void docParserPushContext()
 {
   //QCString indent;
   //indent.fill(' ',g_parserStack.count()*2+2);
-  //printf("%sdocParserPushContext() count=%d\n",indent.data(),g_nodeStack.count());
+  //printf("%sdocParserPushContext() count=%d\n",indent.data(),g_ctx->nodeStack.count());
 
   doctokenizerYYpushContext();
-  DocParserContext *ctx   = new DocParserContext;
-  ctx->scope              = g_scope;
-  ctx->context            = g_context;
-  ctx->inSeeBlock         = g_inSeeBlock;
-  ctx->xmlComment         = g_xmlComment;
-  ctx->insideHtmlLink     = g_insideHtmlLink;
-  ctx->nodeStack          = g_nodeStack;
-  ctx->styleStack         = g_styleStack;
-  ctx->initialStyleStack  = g_initialStyleStack;
-  ctx->copyStack          = g_copyStack;
-  ctx->fileName           = g_fileName;
-  ctx->lineNo             = doctokenizerYYlineno;
-  ctx->relPath            = g_relPath;
-
-  if (saveParamInfo)
-  {
-    ctx->hasParamCommand    = g_hasParamCommand;
-    ctx->hasReturnCommand   = g_hasReturnCommand;
-    ctx->paramsFound        = g_paramsFound;
-  }
-
-  ctx->memberDef          = g_memberDef;
-  ctx->isExample          = g_isExample;
-  ctx->exampleName        = g_exampleName;
-  ctx->sectionDict        = g_sectionDict;
-  ctx->searchUrl          = g_searchUrl;
-
-  ctx->includeFileText    = g_includeFileText;
-  ctx->includeFileOffset  = g_includeFileOffset;
-  ctx->includeFileLength  = g_includeFileLength;
-  
-  ctx->token              = g_token;
+  DocParserContext *ctx = new DocParserContext(*g_ctx);
+  g_ctx->lineNo = doctokenizerYYlineno;
+  g_ctx->token  = g_token;
+  g_parserStack.push(g_ctx);
+  g_ctx   = ctx;
   g_token = new TokenInfo;
-
-  g_parserStack.push(ctx);
 }
 
+/*! Ends a nested parse and continues with the state that was active when
+ *  docParserPushContext() was called. If \a keepParamInfo is TRUE, the
+ *  parameter information collected by the nested parse is kept.
+ */
 static void docParserPopContext(bool keepParamInfo=FALSE)
 {
   DocParserContext *ctx = g_parserStack.pop();
-  g_scope               = ctx->scope;
-  g_context             = ctx->context;
-  g_inSeeBlock          = ctx->inSeeBlock;
-  g_xmlComment          = ctx->xmlComment;
-  g_insideHtmlLink      = ctx->insideHtmlLink;
-  g_nodeStack           = ctx->nodeStack;
-  g_styleStack          = ctx->styleStack;
-  g_initialStyleStack   = ctx->initialStyleStack;
-  g_copyStack           = ctx->copyStack;
-  g_fileName            = ctx->fileName;
-  doctokenizerYYlineno  = ctx->lineNo;
-  g_relPath             = ctx->relPath;
-
-  if (!keepParamInfo)
-  {
-    g_hasParamCommand     = ctx->hasParamCommand;
-    g_hasReturnCommand    = ctx->hasReturnCommand;
-    g_paramsFound         = ctx->paramsFound;
-  }
-  g_memberDef           = ctx->memberDef;
-  g_isExample           = ctx->isExample;
-  g_exampleName         = ctx->exampleName;
-  g_sectionDict         = ctx->sectionDict;
-  g_searchUrl           = ctx->searchUrl;
-
-  g_includeFileText     = ctx->includeFileText;
-  g_includeFileOffset   = ctx->includeFileOffset;
-  g_includeFileLength   = ctx->includeFileLength;
+  if (keepParamInfo)
+  {
+    ctx->hasParamCommand  = g_ctx->hasParamCommand;
+    ctx->hasReturnCommand = g_ctx->hasReturnCommand;
+    ctx->paramsFound      = g_ctx->paramsFound;
+  }
+  delete g_ctx;
+  g_ctx = ctx;
+  doctokenizerYYlineno  = g_ctx->lineNo;
 
   delete g_token;
-  g_token               = ctx->token;
+  g_token               = g_ctx->token;
 
-  delete ctx;
   doctokenizerYYpopContext();
 
   //QCString indent;
   //indent.fill(' ',g_parserStack.count()*2+2);
-  //printf("%sdocParserPopContext() count=%d\n",indent.data(),g_nodeStack.count());
+  //printf("%sdocParserPopContext() count=%d\n",indent.data(),g_ctx->nodeStack.count());
+}
+
+//---------------------------------------------------------------------------
+
+#define DOCNODE_POOL_ALIGN     8
+#define DOCNODE_POOL_MAX_SIZE  128
+#define DOCNODE_CHUNK_SIZE     256
+
+/** Allocator for small DocNode objects.
+ *
+ *  A documentation block is turned into many small nodes (words, white
+ *  space, style changes, ...) that are all deleted again once the block has
+ *  been written. Nodes of at most DOCNODE_POOL_MAX_SIZE bytes are taken from
+ *  a free list per size class. An empty free list is refilled with a chunk
+ *  of DOCNODE_CHUNK_SIZE nodes, so the nodes of a tree are close together in
+ *  memory and deleting a tree only relinks its nodes.
+ */
+class DocNodePool
+{
+  public:
+    DocNodePool() : m_chunks(0)
+    {
+      for (int i=0;i<NUM_SIZE_CLASSES;i++) m_freeList[i]=0;
+    }
+   ~DocNodePool()
+    {
+      while (m_chunks)
+      {
+        Chunk *next = m_chunks->next;
+        ::operator delete(m_chunks);
+        m_chunks = next;
+      }
+    }
+    static bool isPooled(size_t size)
+    {
+      return size<=DOCNODE_POOL_MAX_SIZE;
+    }
+    void *alloc(size_t size)
+    {
+      int c = sizeClass(size);
+      if (m_freeList[c]==0) newChunk(c);
+      FreeNode *n = m_freeList[c];
+      m_freeList[c] = n->next;
+      return n;
+    }
+    void release(void *p,size_t size)
+    {
+      int c = sizeClass(size);
+      FreeNode *n = (FreeNode*)p;
+      n->next = m_freeList[c];
+      m_freeList[c] = n;
+    }
+  private:
+    enum { NUM_SIZE_CLASSES = DOCNODE_POOL_MAX_SIZE/DOCNODE_POOL_ALIGN };
+    struct FreeNode
+    {
+      FreeNode *next;
+    };
+    union Chunk
+    {
+      Chunk  *next;
+      double  align;
+      char    header[DOCNODE_POOL_ALIGN];
+    };
+    static int sizeClass(size_t size)
+    {
+      return size==0 ? 0 : (int)((size-1)/DOCNODE_POOL_ALIGN);
+    }
+    void newChunk(int c)
+    {
+      size_t nodeSize = (c+1)*DOCNODE_POOL_ALIGN;
+      Chunk *chunk = (Chunk*)::operator new(sizeof(Chunk)+nodeSize*DOCNODE_CHUNK_SIZE);
+      chunk->next = m_chunks;
+      m_chunks = chunk;
+      // link the nodes in order, so consecutive allocations are adjacent
+      char *nodes = (char*)(chunk+1);
+      for (int i=DOCNODE_CHUNK_SIZE-1;i>=0;i--)
+      {
+        FreeNode *n = (FreeNode*)(nodes+i*nodeSize);
+        n->next = m_freeList[c];
+        m_freeList[c] = n;
+      }
+    }
+    Chunk    *m_chunks;
+    FreeNode *m_freeList[NUM_SIZE_CLASSES];
+};
+
+// intentionally never deleted: nodes may still be released during exit
+static DocNodePool *g_docNodePool = 0;
+
+void *DocNode::operator new(size_t size)
+{
+  if (!DocNodePool::isPooled(size)) return ::operator new(size);
+  if (g_docNodePool==0) g_docNodePool = new DocNodePool;
+  return g_docNodePool->alloc(size);
+}
+
+void DocNode::operator delete(void *ptr,size_t size)
+{
+  if (ptr==0) return;
+  if (!DocNodePool::isPooled(size)) { ::operator delete(ptr); return; }
+  g_docNodePool->release(ptr,size);
 }
 
 //---------------------------------------------------------------------------
@@ -306,7 +350,7 @@ static QCString findAndCopyImage(const char *fileName,DocImage::Type type)
       if (outfi.isSymLink())
       {
         QFile::remove(outputFile);
-        warn_doc_error(g_fileName,doctokenizerYYlineno,
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,
             "destination of image %s is a symlink, replacing with image",
             qPrint(outputFile));
       }
@@ -324,7 +368,7 @@ static QCString findAndCopyImage(const char *fileName,DocImage::Type type)
         }
         else
         {
-          warn_doc_error(g_fileName,doctokenizerYYlineno,
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,
               "could not write output image %s",qPrint(outputFile));
         }
       }
@@ -335,7 +379,7 @@ static QCString findAndCopyImage(const char *fileName,DocImage::Type type)
     }
     else
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,
 	  "could not open image %s",qPrint(fileName));
     }
 
@@ -364,14 +408,14 @@ static QCString findAndCopyImage(const char *fileName,DocImage::Type type)
     text.sprintf("image file name %s is ambiguous.\n",qPrint(fileName));
     text+="Possible candidates:\n";
     text+=showFileDefMatches(Doxygen::imageNameDict,fileName);
-    warn_doc_error(g_fileName,doctokenizerYYlineno,text);
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,text);
   }
   else
   {
     result=fileName;
     if (result.left(5)!="http:" && result.left(6)!="https:")
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,
            "image file %s is not found in IMAGE_PATH: "  
 	   "assuming external image.",qPrint(fileName)
           );
@@ -381,20 +425,20 @@ static QCString findAndCopyImage(const char *fileName,DocImage::Type type)
 }
 
 /*! Collects the parameters found with \@param or \@retval commands
- *  in a global list g_paramsFound. If \a isParam is set to TRUE
+ *  in a global list g_ctx->paramsFound. If \a isParam is set to TRUE
  *  and the parameter is not an actual parameter of the current
- *  member g_memberDef, then a warning is raised (unless warnings
+ *  member g_ctx->memberDef, then a warning is raised (unless warnings
  *  are disabled altogether).
  */
 static void checkArgumentName(const QCString &name,bool isParam)
 {                
   if (!Config_getBool(WARN_IF_DOC_ERROR)) return;
-  if (g_memberDef==0) return; // not a member
-  ArgumentList *al=g_memberDef->isDocsForDefinition() ? 
-		   g_memberDef->argumentList() :
-                   g_memberDef->declArgumentList();
-  SrcLangExt lang = g_memberDef->getLanguage();
-  //printf("isDocsForDefinition()=%d\n",g_memberDef->isDocsForDefinition());
+  if (g_ctx->memberDef==0) return; // not a member
+  ArgumentList *al=g_ctx->memberDef->isDocsForDefinition() ? 
+		   g_ctx->memberDef->argumentList() :
+                   g_ctx->memberDef->declArgumentList();
+  SrcLangExt lang = g_ctx->memberDef->getLanguage();
+  //printf("isDocsForDefinition()=%d\n",g_ctx->memberDef->isDocsForDefinition());
   if (al==0) return; // no argument list
 
   static QRegExp re("$?[a-zA-Z0-9_\\x80-\\xFF]+\\.*");
@@ -409,14 +453,14 @@ static void checkArgumentName(const QCString &name,bool isParam)
     bool found=FALSE;
     for (ali.toFirst();(a=ali.current());++ali)
     {
-      QCString argName = g_memberDef->isDefine() ? a->type : a->name;
+      QCString argName = g_ctx->memberDef->isDefine() ? a->type : a->name;
       if (lang==SrcLangExt_Fortran) argName=argName.lower();
       argName=argName.stripWhiteSpace();
       //printf("argName=`%s' aName=%s\n",argName.data(),aName.data());
       if (argName.right(3)=="...") argName=argName.left(argName.length()-3);
       if (aName==argName) 
       {
-	g_paramsFound.insert(aName,(void *)(0x8));
+	g_ctx->paramsFound.insert(aName,(void *)(0x8));
 	found=TRUE;
 	break;
       }
@@ -424,26 +468,26 @@ static void checkArgumentName(const QCString &name,bool isParam)
     if (!found && isParam)
     {
       //printf("member type=%d\n",memberDef->memberType());
-      QCString scope=g_memberDef->getScopeString();
+      QCString scope=g_ctx->memberDef->getScopeString();
       if (!scope.isEmpty()) scope+="::"; else scope="";
       QCString inheritedFrom = "";
-      QCString docFile = g_memberDef->docFile();
-      int docLine = g_memberDef->docLine();
-      MemberDef *inheritedMd = g_memberDef->inheritsDocsFrom();
+      QCString docFile = g_ctx->memberDef->docFile();
+      int docLine = g_ctx->memberDef->docLine();
+      MemberDef *inheritedMd = g_ctx->memberDef->inheritsDocsFrom();
       if (inheritedMd) // documentation was inherited
       {
         inheritedFrom.sprintf(" inherited from member %s at line "
             "%d in file %s",qPrint(inheritedMd->name()),
             inheritedMd->docLine(),qPrint(inheritedMd->docFile()));
-        docFile = g_memberDef->getDefFileName();
-        docLine = g_memberDef->getDefLine();
+        docFile = g_ctx->memberDef->getDefFileName();
+        docLine = g_ctx->memberDef->getDefLine();
         
       }
       QCString alStr = argListToString(al);
       warn_doc_error(docFile,docLine,
 	  "argument '%s' of command @param "
 	  "is not found in the argument list of %s%s%s%s",
-	  qPrint(aName), qPrint(scope), qPrint(g_memberDef->name()),
+	  qPrint(aName), qPrint(scope), qPrint(g_ctx->memberDef->name()),
 	  qPrint(alStr), qPrint(inheritedFrom));
     }
     p=i+l;
@@ -457,12 +501,12 @@ static void checkArgumentName(const QCString &name,bool isParam)
  */
 static void checkUndocumentedParams()
 {
-  if (g_memberDef && g_hasParamCommand && Config_getBool(WARN_IF_DOC_ERROR))
+  if (g_ctx->memberDef && g_ctx->hasParamCommand && Config_getBool(WARN_IF_DOC_ERROR))
   {
-    ArgumentList *al=g_memberDef->isDocsForDefinition() ? 
-      g_memberDef->argumentList() :
-      g_memberDef->declArgumentList();
-    SrcLangExt lang = g_memberDef->getLanguage();
+    ArgumentList *al=g_ctx->memberDef->isDocsForDefinition() ? 
+      g_ctx->memberDef->argumentList() :
+      g_ctx->memberDef->declArgumentList();
+    SrcLangExt lang = g_ctx->memberDef->getLanguage();
     if (al!=0)
     {
       ArgumentListIterator ali(*al);
@@ -470,15 +514,15 @@ static void checkUndocumentedParams()
       bool found=FALSE;
       for (ali.toFirst();(a=ali.current());++ali)
       {
-        QCString argName = g_memberDef->isDefine() ? a->type : a->name;
+        QCString argName = g_ctx->memberDef->isDefine() ? a->type : a->name;
         if (lang==SrcLangExt_Fortran) argName = argName.lower();
         argName=argName.stripWhiteSpace();
         if (argName.right(3)=="...") argName=argName.left(argName.length()-3);
-        if (g_memberDef->getLanguage()==SrcLangExt_Python && (argName=="self" || argName=="cls"))
+        if (g_ctx->memberDef->getLanguage()==SrcLangExt_Python && (argName=="self" || argName=="cls"))
         { 
           // allow undocumented self / cls parameter for Python
         }
-        else if (!argName.isEmpty() && g_paramsFound.find(argName)==0 && a->docs.isEmpty()) 
+        else if (!argName.isEmpty() && g_ctx->paramsFound.find(argName)==0 && a->docs.isEmpty()) 
         {
           found = TRUE;
           break;
@@ -489,19 +533,19 @@ static void checkUndocumentedParams()
         bool first=TRUE;
         QCString errMsg=
             "The following parameters of "+
-            QCString(g_memberDef->qualifiedName()) + 
+            QCString(g_ctx->memberDef->qualifiedName()) + 
             QCString(argListToString(al)) +
             " are not documented:\n";
         for (ali.toFirst();(a=ali.current());++ali)
         {
-          QCString argName = g_memberDef->isDefine() ? a->type : a->name;
+          QCString argName = g_ctx->memberDef->isDefine() ? a->type : a->name;
           if (lang==SrcLangExt_Fortran) argName = argName.lower();
           argName=argName.stripWhiteSpace();
-          if (g_memberDef->getLanguage()==SrcLangExt_Python && (argName=="self" || argName=="cls"))
+          if (g_ctx->memberDef->getLanguage()==SrcLangExt_Python && (argName=="self" || argName=="cls"))
           { 
             // allow undocumented self / cls parameter for Python
           }
-          else if (!argName.isEmpty() && g_paramsFound.find(argName)==0) 
+          else if (!argName.isEmpty() && g_ctx->paramsFound.find(argName)==0) 
           {
             if (!first)
             {
@@ -514,8 +558,8 @@ static void checkUndocumentedParams()
             errMsg+="  parameter '"+argName+"'";
           }
         }
-        warn_doc_error(g_memberDef->getDefFileName(),
-                       g_memberDef->getDefLine(),
+        warn_doc_error(g_ctx->memberDef->getDefFileName(),
+                       g_ctx->memberDef->getDefLine(),
                        substitute(errMsg,"%","%%"));
       }
     }
@@ -529,20 +573,20 @@ static void checkUndocumentedParams()
  */
 static void detectNoDocumentedParams()
 {
-  if (g_memberDef && Config_getBool(WARN_NO_PARAMDOC))
+  if (g_ctx->memberDef && Config_getBool(WARN_NO_PARAMDOC))
   {
-    ArgumentList *al     = g_memberDef->argumentList();
-    ArgumentList *declAl = g_memberDef->declArgumentList();
-    QCString returnType   = g_memberDef->typeString();
-    bool isPython = g_memberDef->getLanguage()==SrcLangExt_Python;
+    ArgumentList *al     = g_ctx->memberDef->argumentList();
+    ArgumentList *declAl = g_ctx->memberDef->declArgumentList();
+    QCString returnType   = g_ctx->memberDef->typeString();
+    bool isPython = g_ctx->memberDef->getLanguage()==SrcLangExt_Python;
 
-    if (!g_memberDef->hasDocumentedParams() &&
-        g_hasParamCommand)
+    if (!g_ctx->memberDef->hasDocumentedParams() &&
+        g_ctx->hasParamCommand)
     {
-      //printf("%s->setHasDocumentedParams(TRUE);\n",g_memberDef->name().data());
-      g_memberDef->setHasDocumentedParams(TRUE);
+      //printf("%s->setHasDocumentedParams(TRUE);\n",g_ctx->memberDef->name().data());
+      g_ctx->memberDef->setHasDocumentedParams(TRUE);
     }
-    else if (!g_memberDef->hasDocumentedParams())
+    else if (!g_ctx->memberDef->hasDocumentedParams())
     {
       bool allDoc=TRUE; // no parameter => all parameters are documented
       if ( // member has parameters
@@ -584,39 +628,39 @@ static void detectNoDocumentedParams()
       }
       if (allDoc) 
       {
-        //printf("%s->setHasDocumentedParams(TRUE);\n",g_memberDef->name().data());
-        g_memberDef->setHasDocumentedParams(TRUE);
+        //printf("%s->setHasDocumentedParams(TRUE);\n",g_ctx->memberDef->name().data());
+        g_ctx->memberDef->setHasDocumentedParams(TRUE);
       }
     }
     //printf("Member %s hadDocumentedReturnType()=%d hasReturnCommand=%d\n",
-    //    g_memberDef->name().data(),g_memberDef->hasDocumentedReturnType(),g_hasReturnCommand);
-    if (!g_memberDef->hasDocumentedReturnType() && // docs not yet found
-        g_hasReturnCommand)
+    //    g_ctx->memberDef->name().data(),g_ctx->memberDef->hasDocumentedReturnType(),g_ctx->hasReturnCommand);
+    if (!g_ctx->memberDef->hasDocumentedReturnType() && // docs not yet found
+        g_ctx->hasReturnCommand)
     {
-      g_memberDef->setHasDocumentedReturnType(TRUE);
+      g_ctx->memberDef->setHasDocumentedReturnType(TRUE);
     }
     else if ( // see if return needs to documented 
-        g_memberDef->hasDocumentedReturnType() ||
+        g_ctx->memberDef->hasDocumentedReturnType() ||
         returnType.isEmpty()         || // empty return type
         returnType.find("void")!=-1  || // void return type
         returnType.find("subroutine")!=-1 || // fortran subroutine
-        g_memberDef->isConstructor() || // a constructor
-        g_memberDef->isDestructor()     // or destructor
+        g_ctx->memberDef->isConstructor() || // a constructor
+        g_ctx->memberDef->isDestructor()     // or destructor
        )
     {
-      g_memberDef->setHasDocumentedReturnType(TRUE);
+      g_ctx->memberDef->setHasDocumentedReturnType(TRUE);
     }
     else if ( // see if return type is documented in a function w/o return type
-        g_memberDef->hasDocumentedReturnType() &&
+        g_ctx->memberDef->hasDocumentedReturnType() &&
         (returnType.isEmpty()              || // empty return type
          returnType.find("void")!=-1       || // void return type
          returnType.find("subroutine")!=-1 || // fortran subroutine
-         g_memberDef->isConstructor()      || // a constructor
-         g_memberDef->isDestructor()          // or destructor
+         g_ctx->memberDef->isConstructor()      || // a constructor
+         g_ctx->memberDef->isDestructor()          // or destructor
         )
        )
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"documented empty return type");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"documented empty return type");
     }
   }
 }
@@ -710,7 +754,7 @@ static bool insideTable(DocNode *n)
 //---------------------------------------------------------------------------
 
 /*! Looks for a documentation block with name commandName in the current
- *  context (g_context). The resulting documentation string is
+ *  context (g_ctx->context). The resulting documentation string is
  *  put in pDoc, the definition in which the documentation was found is
  *  put in pDef.
  *  @retval TRUE if name was found.
@@ -760,11 +804,11 @@ static bool findDocsForMemberOrCompound(const char *commandName,
   GroupDef     *gd=0;
   PageDef      *pd=0;
   bool found = getDefs(
-      g_context.find('.')==-1?g_context.data():"", // `find('.') is a hack to detect files
+      g_ctx->context.find('.')==-1?g_ctx->context.data():"", // `find('.') is a hack to detect files
       name,
       args.isEmpty()?0:args.data(),
       md,cd,fd,nd,gd,FALSE,0,TRUE);
-  //printf("found=%d context=%s name=%s\n",found,g_context.data(),name.data());
+  //printf("found=%d context=%s name=%s\n",found,g_ctx->context.data(),name.data());
   if (found && md)
   {
     *pDoc=md->documentation();
@@ -774,13 +818,13 @@ static bool findDocsForMemberOrCompound(const char *commandName,
   }
 
 
-  int scopeOffset=g_context.length();
+  int scopeOffset=g_ctx->context.length();
   do // for each scope
   {
     QCString fullName=cmdArg;
     if (scopeOffset>0)
     {
-      fullName.prepend(g_context.left(scopeOffset)+"::");
+      fullName.prepend(g_ctx->context.left(scopeOffset)+"::");
     }
     //printf("Trying fullName=`%s'\n",fullName.data());
 
@@ -833,7 +877,7 @@ static bool findDocsForMemberOrCompound(const char *commandName,
     }
     else
     {
-      scopeOffset = g_context.findRev("::",scopeOffset-1);
+      scopeOffset = g_ctx->context.findRev("::",scopeOffset-1);
       if (scopeOffset==-1) scopeOffset=0;
     }
   } while (scopeOffset>=0);
@@ -855,7 +899,7 @@ static int handleStyleArgument(DocNode *parent,QList<DocNode> &children,
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
 	qPrint(cmdName));
     return tok;
   }
@@ -878,11 +922,11 @@ static int handleStyleArgument(DocNode *parent,QList<DocNode> &children,
       switch (tok)
       {
         case TK_COMMAND: 
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command \\%s as the argument of a \\%s command",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command \\%s as the argument of a \\%s command",
 	       qPrint(g_token->name),qPrint(cmdName));
           break;
         case TK_SYMBOL: 
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found while handling command %s",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found while handling command %s",
                qPrint(g_token->name),qPrint(cmdName));
           break;
         case TK_HTMLTAG:
@@ -893,7 +937,7 @@ static int handleStyleArgument(DocNode *parent,QList<DocNode> &children,
           return tok;
           break;
         default:
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s while handling command %s",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s while handling command %s",
 	       tokToString(tok),qPrint(cmdName));
           break;
       }
@@ -912,9 +956,9 @@ static void handleStyleEnter(DocNode *parent,QList<DocNode> &children,
           DocStyleChange::Style s,const HtmlAttribList *attribs)
 {
   DBG(("HandleStyleEnter\n"));
-  DocStyleChange *sc= new DocStyleChange(parent,g_nodeStack.count(),s,TRUE,attribs);
+  DocStyleChange *sc= new DocStyleChange(parent,g_ctx->nodeStack.count(),s,TRUE,attribs);
   children.append(sc);
-  g_styleStack.push(sc);
+  g_ctx->styleStack.push(sc);
 }
 
 /*! Called when a style change ends. For instance a \</b\> command is
@@ -924,32 +968,32 @@ static void handleStyleLeave(DocNode *parent,QList<DocNode> &children,
          DocStyleChange::Style s,const char *tagName)
 {
   DBG(("HandleStyleLeave\n"));
-  if (g_styleStack.isEmpty() ||                           // no style change
-      g_styleStack.top()->style()!=s ||                   // wrong style change
-      g_styleStack.top()->position()!=g_nodeStack.count() // wrong position
+  if (g_ctx->styleStack.isEmpty() ||                           // no style change
+      g_ctx->styleStack.top()->style()!=s ||                   // wrong style change
+      g_ctx->styleStack.top()->position()!=g_ctx->nodeStack.count() // wrong position
      )
   {
-    if (g_styleStack.isEmpty())
+    if (g_ctx->styleStack.isEmpty())
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"found </%s> tag without matching <%s>",
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found </%s> tag without matching <%s>",
           qPrint(tagName),qPrint(tagName));
     }
-    else if (g_styleStack.top()->style()!=s)
+    else if (g_ctx->styleStack.top()->style()!=s)
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"found </%s> tag while expecting </%s>",
-          qPrint(tagName),qPrint(g_styleStack.top()->styleString()));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found </%s> tag while expecting </%s>",
+          qPrint(tagName),qPrint(g_ctx->styleStack.top()->styleString()));
     }
     else
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"found </%s> at different nesting level (%d) than expected (%d)",
-          qPrint(tagName),g_nodeStack.count(),g_styleStack.top()->position());
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found </%s> at different nesting level (%d) than expected (%d)",
+          qPrint(tagName),g_ctx->nodeStack.count(),g_ctx->styleStack.top()->position());
     }
   }
   else // end the section
   {
-    DocStyleChange *sc= new DocStyleChange(parent,g_nodeStack.count(),s,FALSE);
+    DocStyleChange *sc= new DocStyleChange(parent,g_ctx->nodeStack.count(),s,FALSE);
     children.append(sc);
-    g_styleStack.pop();
+    g_ctx->styleStack.pop();
   }
 }
 
@@ -959,15 +1003,15 @@ static void handleStyleLeave(DocNode *parent,QList<DocNode> &children,
  */
 static void handlePendingStyleCommands(DocNode *parent,QList<DocNode> &children)
 {
-  if (!g_styleStack.isEmpty())
+  if (!g_ctx->styleStack.isEmpty())
   {
-    DocStyleChange *sc = g_styleStack.top();
-    while (sc && sc->position()>=g_nodeStack.count()) 
+    DocStyleChange *sc = g_ctx->styleStack.top();
+    while (sc && sc->position()>=g_ctx->nodeStack.count()) 
     { // there are unclosed style modifiers in the paragraph
-      children.append(new DocStyleChange(parent,g_nodeStack.count(),sc->style(),FALSE));
-      g_initialStyleStack.push(sc);
-      g_styleStack.pop();
-      sc = g_styleStack.top();
+      children.append(new DocStyleChange(parent,g_ctx->nodeStack.count(),sc->style(),FALSE));
+      g_ctx->initialStyleStack.push(sc);
+      g_ctx->styleStack.pop();
+      sc = g_ctx->styleStack.top();
     }
   }
 }
@@ -975,7 +1019,7 @@ static void handlePendingStyleCommands(DocNode *parent,QList<DocNode> &children)
 static void handleInitialStyleCommands(DocPara *parent,QList<DocNode> &children)
 {
   DocStyleChange *sc;
-  while ((sc=g_initialStyleStack.pop()))
+  while ((sc=g_ctx->initialStyleStack.pop()))
   {
     handleStyleEnter(parent,children,sc->style(),&sc->attribs());
   }
@@ -999,7 +1043,7 @@ static int handleAHref(DocNode *parent,QList<DocNode> &children,const HtmlAttrib
       }
       else
       {
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"found <a> tag with name option but without value!");
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found <a> tag with name option but without value!");
       }
     }
     else if (opt->name=="href") // <a href=url>..</a> tag
@@ -1009,11 +1053,11 @@ static int handleAHref(DocNode *parent,QList<DocNode> &children,const HtmlAttrib
       // and remove the href attribute
       bool result = attrList.remove(index);
       ASSERT(result);
-      DocHRef *href = new DocHRef(parent,attrList,opt->value,g_relPath);
+      DocHRef *href = new DocHRef(parent,attrList,opt->value,g_ctx->relPath);
       children.append(href);
-      g_insideHtmlLink=TRUE;
+      g_ctx->insideHtmlLink=TRUE;
       retval = href->parse();
-      g_insideHtmlLink=FALSE;
+      g_ctx->insideHtmlLink=FALSE;
       break;
     }
     else // unsupported option for tag a
@@ -1043,12 +1087,12 @@ const char *DocStyleChange::styleString() const
 
 static void handleUnclosedStyleCommands()
 {
-  if (!g_initialStyleStack.isEmpty())
+  if (!g_ctx->initialStyleStack.isEmpty())
   {
-    DocStyleChange *sc = g_initialStyleStack.top();
-    g_initialStyleStack.pop();
+    DocStyleChange *sc = g_ctx->initialStyleStack.top();
+    g_ctx->initialStyleStack.pop();
     handleUnclosedStyleCommands();
-    warn_doc_error(g_fileName,doctokenizerYYlineno,
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,
              "end of comment block while expecting "
              "command </%s>",qPrint(sc->styleString()));
   }
@@ -1071,12 +1115,12 @@ static void handleLinkedWord(DocNode *parent,QList<DocNode> &children,bool ignor
   int len = g_token->name.length();
   ClassDef *cd=0;
   bool ambig;
-  FileDef *fd = findFileDef(Doxygen::inputNameDict,g_fileName,ambig);
-  //printf("handleLinkedWord(%s) g_context=%s\n",g_token->name.data(),g_context.data());
-  if (!g_insideHtmlLink && 
-      (resolveRef(g_context,g_token->name,g_inSeeBlock,&compound,&member,TRUE,fd,TRUE)
-       || (!g_context.isEmpty() &&  // also try with global scope
-           resolveRef("",g_token->name,g_inSeeBlock,&compound,&member,FALSE,0,TRUE))
+  FileDef *fd = findFileDef(Doxygen::inputNameDict,g_ctx->fileName,ambig);
+  //printf("handleLinkedWord(%s) g_context=%s\n",g_token->name.data(),g_ctx->context.data());
+  if (!g_ctx->insideHtmlLink && 
+      (resolveRef(g_ctx->context,g_token->name,g_ctx->inSeeBlock,&compound,&member,TRUE,fd,TRUE)
+       || (!g_ctx->context.isEmpty() &&  // also try with global scope
+           resolveRef("",g_token->name,g_ctx->inSeeBlock,&compound,&member,FALSE,0,TRUE))
       )
      )
   {
@@ -1085,8 +1129,8 @@ static void handleLinkedWord(DocNode *parent,QList<DocNode> &children,bool ignor
     {
       if (member->isObjCMethod()) 
       {
-        bool localLink = g_memberDef ? member->getClassDef()==g_memberDef->getClassDef() : FALSE;
-        name = member->objCMethodName(localLink,g_inSeeBlock);
+        bool localLink = g_ctx->memberDef ? member->getClassDef()==g_ctx->memberDef->getClassDef() : FALSE;
+        name = member->objCMethodName(localLink,g_ctx->inSeeBlock);
       }
       children.append(new 
           DocLinkedWord(parent,name,
@@ -1135,7 +1179,7 @@ static void handleLinkedWord(DocNode *parent,QList<DocNode> &children,bool ignor
       children.append(new DocWord(parent,name));
     }
   }
-  else if (!g_insideHtmlLink && len>1 && g_token->name.at(len-1)==':')
+  else if (!g_ctx->insideHtmlLink && len>1 && g_token->name.at(len-1)==':')
   {
     // special case, where matching Foo: fails to be an Obj-C reference, 
     // but Foo itself might be linkable.
@@ -1143,7 +1187,7 @@ static void handleLinkedWord(DocNode *parent,QList<DocNode> &children,bool ignor
     handleLinkedWord(parent,children,ignoreAutoLinkFlag);
     children.append(new DocWord(parent,":"));
   }
-  else if (!g_insideHtmlLink && (cd=getClass(g_token->name+"-p")))
+  else if (!g_ctx->insideHtmlLink && (cd=getClass(g_token->name+"-p")))
   {
     // special case 2, where the token name is not a class, but could
     // be a Obj-C protocol
@@ -1155,7 +1199,7 @@ static void handleLinkedWord(DocNode *parent,QList<DocNode> &children,bool ignor
           cd->briefDescriptionAsTooltip()
           ));
   }
-//  else if (!g_insideHtmlLink && (cd=getClass(g_token->name+"-g")))
+//  else if (!g_ctx->insideHtmlLink && (cd=getClass(g_token->name+"-g")))
 //  {
 //    // special case 3, where the token name is not a class, but could
 //    // be a C# generic
@@ -1171,7 +1215,7 @@ static void handleLinkedWord(DocNode *parent,QList<DocNode> &children,bool ignor
   {
     if (g_token->name.left(1)=="#" || g_token->name.left(2)=="::")
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"explicit link request to '%s' could not be resolved",qPrint(name));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"explicit link request to '%s' could not be resolved",qPrint(name));
       children.append(new DocWord(parent,g_token->name));
     }
     else
@@ -1203,7 +1247,7 @@ static DocInternalRef *handleInternalRef(DocNode *parent)
   QCString tokenName = g_token->name;
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint(tokenName));
     return 0;
   }
@@ -1211,7 +1255,7 @@ static DocInternalRef *handleInternalRef(DocNode *parent)
   tok=doctokenizerYYlex(); // get the reference id
   if (tok!=TK_WORD && tok!=TK_LNKWORD)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
         tokToString(tok),qPrint(tokenName));
     return 0;
   }
@@ -1223,7 +1267,7 @@ static DocAnchor *handleAnchor(DocNode *parent)
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint(g_token->name));
     return 0;
   }
@@ -1231,13 +1275,13 @@ static DocAnchor *handleAnchor(DocNode *parent)
   tok=doctokenizerYYlex();
   if (tok==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
         "argument of command %s",qPrint(g_token->name));
     return 0;
   }
   else if (tok!=TK_WORD && tok!=TK_LNKWORD)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
         tokToString(tok),qPrint(g_token->name));
     return 0;
   }
@@ -1257,7 +1301,7 @@ static DocAnchor *handleAnchor(DocNode *parent)
  */
 static void defaultHandleTitleAndSize(const int cmd, DocNode *parent, QList<DocNode> &children, QCString &width,QCString &height)
 {
-  g_nodeStack.push(parent);
+  g_ctx->nodeStack.push(parent);
 
   // parse title
   doctokenizerYYsetStateTitle();
@@ -1274,15 +1318,15 @@ static void defaultHandleTitleAndSize(const int cmd, DocNode *parent, QList<DocN
       switch (tok)
       {
         case TK_COMMAND:
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\%s",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\%s",
               qPrint(g_token->name), Mappers::cmdMapper->find(cmd).data());
           break;
         case TK_SYMBOL:
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
               qPrint(g_token->name));
           break;
         default:
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
               tokToString(tok));
           break;
       }
@@ -1313,7 +1357,7 @@ static void defaultHandleTitleAndSize(const int cmd, DocNode *parent, QList<DocN
       }
       else
       {
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"Unknown option '%s' after \\%s command, expected 'width' or 'height'",
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unknown option '%s' after \\%s command, expected 'width' or 'height'",
                        qPrint(g_token->name), Mappers::cmdMapper->find(cmd).data());
         break;
       }
@@ -1324,7 +1368,7 @@ static void defaultHandleTitleAndSize(const int cmd, DocNode *parent, QList<DocN
   doctokenizerYYsetStatePara();
 
   handlePendingStyleCommands(parent,children);
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==parent);
 }
 
@@ -1407,9 +1451,9 @@ reparsetoken:
           break;
         case CMD_EMPHASIS:
           {
-            children.append(new DocStyleChange(parent,g_nodeStack.count(),DocStyleChange::Italic,TRUE));
+            children.append(new DocStyleChange(parent,g_ctx->nodeStack.count(),DocStyleChange::Italic,TRUE));
             tok=handleStyleArgument(parent,children,tokenName);
-            children.append(new DocStyleChange(parent,g_nodeStack.count(),DocStyleChange::Italic,FALSE));
+            children.append(new DocStyleChange(parent,g_ctx->nodeStack.count(),DocStyleChange::Italic,FALSE));
             if (tok!=TK_WORD) children.append(new DocWhiteSpace(parent," "));
             if (tok==TK_NEWPARA) goto handlepara;
             else if (tok==TK_WORD || tok==TK_HTMLTAG) 
@@ -1421,9 +1465,9 @@ reparsetoken:
           break;
         case CMD_BOLD:
           {
-            children.append(new DocStyleChange(parent,g_nodeStack.count(),DocStyleChange::Bold,TRUE));
+            children.append(new DocStyleChange(parent,g_ctx->nodeStack.count(),DocStyleChange::Bold,TRUE));
             tok=handleStyleArgument(parent,children,tokenName);
-            children.append(new DocStyleChange(parent,g_nodeStack.count(),DocStyleChange::Bold,FALSE));
+            children.append(new DocStyleChange(parent,g_ctx->nodeStack.count(),DocStyleChange::Bold,FALSE));
             if (tok!=TK_WORD) children.append(new DocWhiteSpace(parent," "));
             if (tok==TK_NEWPARA) goto handlepara;
             else if (tok==TK_WORD || tok==TK_HTMLTAG) 
@@ -1435,9 +1479,9 @@ reparsetoken:
           break;
         case CMD_CODE:
           {
-            children.append(new DocStyleChange(parent,g_nodeStack.count(),DocStyleChange::Code,TRUE));
+            children.append(new DocStyleChange(parent,g_ctx->nodeStack.count(),DocStyleChange::Code,TRUE));
             tok=handleStyleArgument(parent,children,tokenName);
-            children.append(new DocStyleChange(parent,g_nodeStack.count(),DocStyleChange::Code,FALSE));
+            children.append(new DocStyleChange(parent,g_ctx->nodeStack.count(),DocStyleChange::Code,FALSE));
             if (tok!=TK_WORD) children.append(new DocWhiteSpace(parent," "));
             if (tok==TK_NEWPARA) goto handlepara;
             else if (tok==TK_WORD || tok==TK_HTMLTAG) 
@@ -1451,8 +1495,8 @@ reparsetoken:
           {
             doctokenizerYYsetStateHtmlOnly();
             tok = doctokenizerYYlex();
-            children.append(new DocVerbatim(parent,g_context,g_token->verb,DocVerbatim::HtmlOnly,g_isExample,g_exampleName,g_token->name=="block"));
-            if (tok==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"htmlonly section ended without end marker");
+            children.append(new DocVerbatim(parent,g_ctx->context,g_token->verb,DocVerbatim::HtmlOnly,g_ctx->isExample,g_ctx->exampleName,g_token->name=="block"));
+            if (tok==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"htmlonly section ended without end marker");
             doctokenizerYYsetStatePara();
           }
           break;
@@ -1460,8 +1504,8 @@ reparsetoken:
           {
             doctokenizerYYsetStateManOnly();
             tok = doctokenizerYYlex();
-            children.append(new DocVerbatim(parent,g_context,g_token->verb,DocVerbatim::ManOnly,g_isExample,g_exampleName));
-            if (tok==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"manonly section ended without end marker");
+            children.append(new DocVerbatim(parent,g_ctx->context,g_token->verb,DocVerbatim::ManOnly,g_ctx->isExample,g_ctx->exampleName));
+            if (tok==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"manonly section ended without end marker");
             doctokenizerYYsetStatePara();
           }
           break;
@@ -1469,8 +1513,8 @@ reparsetoken:
           {
             doctokenizerYYsetStateRtfOnly();
             tok = doctokenizerYYlex();
-            children.append(new DocVerbatim(parent,g_context,g_token->verb,DocVerbatim::RtfOnly,g_isExample,g_exampleName));
-            if (tok==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"rtfonly section ended without end marker");
+            children.append(new DocVerbatim(parent,g_ctx->context,g_token->verb,DocVerbatim::RtfOnly,g_ctx->isExample,g_ctx->exampleName));
+            if (tok==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"rtfonly section ended without end marker");
             doctokenizerYYsetStatePara();
           }
           break;
@@ -1478,8 +1522,8 @@ reparsetoken:
           {
             doctokenizerYYsetStateLatexOnly();
             tok = doctokenizerYYlex();
-            children.append(new DocVerbatim(parent,g_context,g_token->verb,DocVerbatim::LatexOnly,g_isExample,g_exampleName));
-            if (tok==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"latexonly section ended without end marker",doctokenizerYYlineno);
+            children.append(new DocVerbatim(parent,g_ctx->context,g_token->verb,DocVerbatim::LatexOnly,g_ctx->isExample,g_ctx->exampleName));
+            if (tok==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"latexonly section ended without end marker",doctokenizerYYlineno);
             doctokenizerYYsetStatePara();
           }
           break;
@@ -1487,8 +1531,8 @@ reparsetoken:
           {
             doctokenizerYYsetStateXmlOnly();
             tok = doctokenizerYYlex();
-            children.append(new DocVerbatim(parent,g_context,g_token->verb,DocVerbatim::XmlOnly,g_isExample,g_exampleName));
-            if (tok==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"xmlonly section ended without end marker",doctokenizerYYlineno);
+            children.append(new DocVerbatim(parent,g_ctx->context,g_token->verb,DocVerbatim::XmlOnly,g_ctx->isExample,g_ctx->exampleName));
+            if (tok==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"xmlonly section ended without end marker",doctokenizerYYlineno);
             doctokenizerYYsetStatePara();
           }
           break;
@@ -1496,8 +1540,8 @@ reparsetoken:
           {
             doctokenizerYYsetStateDbOnly();
             tok = doctokenizerYYlex();
-            children.append(new DocVerbatim(parent,g_context,g_token->verb,DocVerbatim::DocbookOnly,g_isExample,g_exampleName));
-            if (tok==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"docbookonly section ended without end marker",doctokenizerYYlineno);
+            children.append(new DocVerbatim(parent,g_ctx->context,g_token->verb,DocVerbatim::DocbookOnly,g_ctx->isExample,g_ctx->exampleName));
+            if (tok==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"docbookonly section ended without end marker",doctokenizerYYlineno);
             doctokenizerYYsetStatePara();
           }
           break;
@@ -1533,7 +1577,7 @@ reparsetoken:
             doctokenizerYYsetStateSetScope();
             doctokenizerYYlex();
             scope = g_token->name;
-            g_context = scope;
+            g_ctx->context = scope;
             //printf("Found scope='%s'\n",scope.data());
             doctokenizerYYsetStatePara();
           }
@@ -1547,10 +1591,10 @@ reparsetoken:
         switch (Mappers::htmlTagMapper->map(tokenName))
         {
           case HTML_DIV:
-            warn_doc_error(g_fileName,doctokenizerYYlineno,"found <div> tag in heading\n");
+            warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found <div> tag in heading\n");
             break;
           case HTML_PRE:
-            warn_doc_error(g_fileName,doctokenizerYYlineno,"found <pre> tag in heading\n");
+            warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found <pre> tag in heading\n");
             break;
           case HTML_BOLD:
             if (!g_token->endTag)
@@ -1667,7 +1711,7 @@ handlepara:
         return FALSE;
       break;
     case TK_URL:
-      if (g_insideHtmlLink)
+      if (g_ctx->insideHtmlLink)
       {
         children.append(new DocWord(parent,g_token->name));
       }
@@ -1707,7 +1751,7 @@ static void handleImg(DocNode *parent,QList<DocNode> &children,const HtmlAttribL
   }
   if (!found)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"IMG tag does not have a SRC attribute!\n");
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"IMG tag does not have a SRC attribute!\n");
   }
 }
 
@@ -1728,7 +1772,7 @@ static int internalValidatingParseDoc(DocNode *parent,QList<DocNode> &children,
 
   if (doc.isEmpty()) return retval;
 
-  doctokenizerYYinit(doc,g_fileName);
+  doctokenizerYYinit(doc,g_ctx->fileName);
 
   // first parse any number of paragraphs
   bool isFirst=TRUE;
@@ -1764,14 +1808,135 @@ static int internalValidatingParseDoc(DocNode *parent,QList<DocNode> &children,
 
 //---------------------------------------------------------------------------
 
+/** Position of a block marked for \\snippet inside an included file */
+struct SnippetBlock
+{
+  int count;  // number of times the marker appears in the file
+  int start;  // offset of the first line after the start marker
+  int length; // length of the block up to the line with the end marker
+  int line;   // line number of the first line of the block
+};
+
+/** Contents of a file read by \\include, \\snippet and friends,
+ *  with the snippet blocks located in it so far.
+ */
+struct IncludeFileInfo
+{
+  IncludeFileInfo(const QCString &t) : text(t), snippets(17)
+  { snippets.setAutoDelete(TRUE); }
+  QCString text;
+  QDict<SnippetBlock> snippets;
+};
+
+/** Files that were included before, indexed by the name used to include
+ *  them. The cost of an entry is its size in kilobytes.
+ */
+static QCache<IncludeFileInfo> g_includeFileCache(64*1024,1009);
+
+/** Finds the block of \a text in between a pair of \a marker strings.
+ *  The block consists of the full lines after the line with the first
+ *  marker, up to but excluding the line with the second marker. If the
+ *  second marker is missing, the block is empty. \a sb receives the number
+ *  of markers found, the offset and length of the block, and the line number
+ *  of the line following the first marker.
+ */
+static void findSnippetBlock(const QCString &text,const QCString &marker,SnippetBlock &sb)
+{
+  sb.count  = text.contains(marker.data());
+  sb.start  = 0;
+  sb.length = 0;
+  sb.line   = 1;
+  int m1 = text.find(marker);
+  if (m1==-1) return;
+  int m2 = text.find(marker,m1+marker.length());
+
+  // find start and end line positions for the markers
+  int p=0,i=-1;
+  bool found=FALSE;
+  while (!found && (i=text.find('\n',p))!=-1)
+  {
+    found = (p<=m1 && m1<i); // found the line with the start marker
+    p=i+1;
+    sb.line++;
+  }
+  if (m2==-1) return;
+  int l1=p,l2=-1;
+  int lp=i;
+  if (found)
+  {
+    while ((i=text.find('\n',p))!=-1)
+    {
+      if (p<=m2 && m2<i) // found the line with the end marker
+      {
+        l2=p;
+        break;
+      }
+      p=i+1;
+      lp=i;
+    }
+  }
+  if (l2==-1) // marker at last line without newline (see bug706874)
+  {
+    l2=lp;
+  }
+  if (l2>l1)
+  {
+    sb.start  = l1;
+    sb.length = l2-l1;
+  }
+}
+
+/** Returns the cached contents of the file included as \a file, or 0 if
+ *  the file was not read before.
+ */
+static IncludeFileInfo *findIncludeFile(const QCString &file)
+{
+  g_includeFileCache.setAutoDelete(TRUE);
+  return g_includeFileCache.find(file);
+}
+
+static void addIncludeFile(const QCString &file,const QCString &text)
+{
+  IncludeFileInfo *info = new IncludeFileInfo(text);
+  if (!g_includeFileCache.insert(file,info,text.length()/1024+1))
+  {
+    delete info; // too large to cache
+  }
+}
+
+/** Returns the block marked by \a marker in the included file \a file,
+ *  which has contents \a text.
+ */
+static SnippetBlock findSnippet(const QCString &file,const QCString &text,
+                                const QCString &marker)
+{
+  IncludeFileInfo *info = findIncludeFile(file);
+  SnippetBlock *sb = info ? info->snippets.find(marker) : 0;
+  if (sb) return *sb;
+  SnippetBlock result;
+  findSnippetBlock(text,marker,result);
+  if (info)
+  {
+    info->snippets.insert(marker,new SnippetBlock(result));
+  }
+  return result;
+}
+
 static void readTextFileByName(const QCString &file,QCString &text)
 {
+  IncludeFileInfo *info = findIncludeFile(file);
+  if (info)
+  {
+    text = info->text;
+    return;
+  }
   if (portable_isAbsolutePath(file.data()))
   {
     QFileInfo fi(file);
     if (fi.exists())
     {
       text = fileToString(file,Config_getBool(FILTER_SOURCE_FILES));
+      addIncludeFile(file,text);
       return;
     }
   }
@@ -1784,6 +1949,7 @@ static void readTextFileByName(const QCString &file,QCString &text)
     if (fi.exists())
     {
       text = fileToString(absFileName,Config_getBool(FILTER_SOURCE_FILES));
+      addIncludeFile(file,text);
       return;
     }
     s=examplePathList.next(); 
@@ -1795,17 +1961,18 @@ static void readTextFileByName(const QCString &file,QCString &text)
   if ((fd=findFileDef(Doxygen::exampleNameDict,file,ambig)))
   {
     text = fileToString(fd->absFilePath(),Config_getBool(FILTER_SOURCE_FILES));
+    addIncludeFile(file,text);
   }
   else if (ambig)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"included file name %s is ambiguous"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"included file name %s is ambiguous"
            "Possible candidates:\n%s",qPrint(file),
            qPrint(showFileDefMatches(Doxygen::exampleNameDict,file))
           );
   }
   else
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"included file %s is not found. "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"included file %s is not found. "
            "Check your EXAMPLE_PATH",qPrint(file));
   }
 }
@@ -1816,8 +1983,8 @@ DocWord::DocWord(DocNode *parent,const QCString &word) :
       m_word(word) 
 {
   m_parent = parent; 
-  //printf("new word %s url=%s\n",word.data(),g_searchUrl.data());
-  if (Doxygen::searchIndex && !g_searchUrl.isEmpty())
+  //printf("new word %s url=%s\n",word.data(),g_ctx->searchUrl.data());
+  if (Doxygen::searchIndex && !g_ctx->searchUrl.isEmpty())
   {
     Doxygen::searchIndex->addWord(word,FALSE);
   }
@@ -1829,13 +1996,13 @@ DocLinkedWord::DocLinkedWord(DocNode *parent,const QCString &word,
                   const QCString &ref,const QCString &file,
                   const QCString &anchor,const QCString &tooltip) : 
       m_word(word), m_ref(ref), 
-      m_file(file), m_relPath(g_relPath), m_anchor(anchor),
+      m_file(file), m_relPath(g_ctx->relPath), m_anchor(anchor),
       m_tooltip(tooltip)
 {
   m_parent = parent; 
   //printf("DocLinkedWord: new word %s url=%s tooltip='%s'\n",
-  //    word.data(),g_searchUrl.data(),tooltip.data());
-  if (Doxygen::searchIndex && !g_searchUrl.isEmpty())
+  //    word.data(),g_ctx->searchUrl.data(),tooltip.data());
+  if (Doxygen::searchIndex && !g_ctx->searchUrl.isEmpty())
   {
     Doxygen::searchIndex->addWord(word,FALSE);
   }
@@ -1848,7 +2015,7 @@ DocAnchor::DocAnchor(DocNode *parent,const QCString &id,bool newAnchor)
   m_parent = parent; 
   if (id.isEmpty())
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"Empty anchor label");
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Empty anchor label");
   }
   if (newAnchor) // found <a name="label">
   {
@@ -1864,7 +2031,7 @@ DocAnchor::DocAnchor(DocNode *parent,const QCString &id,bool newAnchor)
     }
     else 
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Invalid cite anchor id `%s'",qPrint(id));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Invalid cite anchor id `%s'",qPrint(id));
       m_anchor = "invalid";
       m_file = "invalid";
     }
@@ -1877,15 +2044,15 @@ DocAnchor::DocAnchor(DocNode *parent,const QCString &id,bool newAnchor)
       //printf("Found anchor %s\n",id.data());
       m_file   = sec->fileName;
       m_anchor = sec->label;
-      if (g_sectionDict && g_sectionDict->find(id)==0)
+      if (g_ctx->sectionDict && g_ctx->sectionDict->find(id)==0)
       {
         //printf("Inserting in dictionary!\n");
-        g_sectionDict->append(id,sec);
+        g_ctx->sectionDict->append(id,sec);
       }
     }
     else
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Invalid anchor id `%s'",qPrint(id));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Invalid anchor id `%s'",qPrint(id));
       m_anchor = "invalid";
       m_file = "invalid";
     }
@@ -1899,7 +2066,7 @@ DocVerbatim::DocVerbatim(DocNode *parent,const QCString &context,
     const QCString &exampleFile,bool isBlock,const QCString &lang)
   : m_context(context), m_text(text), m_type(t),
     m_isExample(isExample), m_exampleFile(exampleFile),
-    m_relPath(g_relPath), m_lang(lang), m_isBlock(isBlock)
+    m_relPath(g_ctx->relPath), m_lang(lang), m_isBlock(isBlock)
 {
   m_parent = parent;
 }
@@ -1918,11 +2085,11 @@ void DocInclude::parse()
       // fall through
     case DontInclude:
       readTextFileByName(m_file,m_text);
-      g_includeFileName   = m_file;
-      g_includeFileText   = m_text;
-      g_includeFileOffset = 0;
-      g_includeFileLength = m_text.length();
-      //printf("g_includeFile=<<%s>>\n",g_includeFileText.data());
+      g_ctx->includeFileName   = m_file;
+      g_ctx->includeFileText   = m_text;
+      g_ctx->includeFileOffset = 0;
+      g_ctx->includeFileLength = m_text.length();
+      //printf("g_includeFile=<<%s>>\n",g_ctx->includeFileText.data());
       break;
     case VerbInclude: 
       // fall through
@@ -1935,13 +2102,19 @@ void DocInclude::parse()
     case Snippet:
     case SnipWithLines:
       readTextFileByName(m_file,m_text);
-      // check here for the existence of the blockId inside the file, so we
-      // only generate the warning once.
-      int count;
-      if (!m_blockId.isEmpty() && (count=m_text.contains(m_blockId.data()))!=2)
-      {
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"block marked with %s for \\snippet should appear twice in file %s, found it %d times\n",
-            m_blockId.data(),m_file.data(),count);
+      if (!m_blockId.isEmpty())
+      {
+        SnippetBlock sb = findSnippet(m_file,m_text,m_blockId);
+        m_blockStart  = sb.start;
+        m_blockLength = sb.length;
+        m_blockLine   = sb.line;
+        // check here for the existence of the blockId inside the file, so we
+        // only generate the warning once.
+        if (sb.count!=2)
+        {
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"block marked with %s for \\snippet should appear twice in file %s, found it %d times\n",
+              m_blockId.data(),m_file.data(),sb.count);
+        }
       }
       break;
     case DocInclude::SnippetDoc: 
@@ -1956,10 +2129,10 @@ void DocInclude::parse()
 
 void DocIncOperator::parse()
 {
-  m_includeFileName = g_includeFileName;
-  const char *p = g_includeFileText;
-  uint l = g_includeFileLength;
-  uint o = g_includeFileOffset;
+  m_includeFileName = g_ctx->includeFileName;
+  const char *p = g_ctx->includeFileText;
+  uint l = g_ctx->includeFileLength;
+  uint o = g_ctx->includeFileOffset;
   DBG(("DocIncOperator::parse() text=%s off=%d len=%d\n",qPrint(p),o,l));
   uint so = o,bo;
   bool nonEmpty = FALSE;
@@ -1980,12 +2153,12 @@ void DocIncOperator::parse()
         }
         o++;
       }
-      if (g_includeFileText.mid(so,o-so).find(m_pattern)!=-1)
+      if (g_ctx->includeFileText.mid(so,o-so).find(m_pattern)!=-1)
       {
-        m_text = g_includeFileText.mid(so,o-so);
+        m_text = g_ctx->includeFileText.mid(so,o-so);
         DBG(("DocIncOperator::parse() Line: %s\n",qPrint(m_text)));
       }
-      g_includeFileOffset = QMIN(l,o+1); // set pointer to start of new line
+      g_ctx->includeFileOffset = QMIN(l,o+1); // set pointer to start of new line
       break;
     case SkipLine:
       while (o<l)
@@ -2005,15 +2178,15 @@ void DocIncOperator::parse()
           }
           o++;
         }
-        if (g_includeFileText.mid(so,o-so).find(m_pattern)!=-1)
+        if (g_ctx->includeFileText.mid(so,o-so).find(m_pattern)!=-1)
         {
-          m_text = g_includeFileText.mid(so,o-so);
+          m_text = g_ctx->includeFileText.mid(so,o-so);
           DBG(("DocIncOperator::parse() SkipLine: %s\n",qPrint(m_text)));
           break;
         }
         o++; // skip new line
       }
-      g_includeFileOffset = QMIN(l,o+1); // set pointer to start of new line
+      g_ctx->includeFileOffset = QMIN(l,o+1); // set pointer to start of new line
       break;
     case Skip:
       while (o<l)
@@ -2033,13 +2206,13 @@ void DocIncOperator::parse()
           }
           o++;
         }
-        if (g_includeFileText.mid(so,o-so).find(m_pattern)!=-1)
+        if (g_ctx->includeFileText.mid(so,o-so).find(m_pattern)!=-1)
         {
           break;
         }
         o++; // skip new line
       }
-      g_includeFileOffset = so; // set pointer to start of new line
+      g_ctx->includeFileOffset = so; // set pointer to start of new line
       break;
     case Until:
       bo=o;
@@ -2060,15 +2233,15 @@ void DocIncOperator::parse()
           }
           o++;
         }
-        if (g_includeFileText.mid(so,o-so).find(m_pattern)!=-1)
+        if (g_ctx->includeFileText.mid(so,o-so).find(m_pattern)!=-1)
         {
-          m_text = g_includeFileText.mid(bo,o-bo);
+          m_text = g_ctx->includeFileText.mid(bo,o-bo);
           DBG(("DocIncOperator::parse() Until: %s\n",qPrint(m_text)));
           break;
         }
         o++; // skip new line
       }
-      g_includeFileOffset = QMIN(l,o+1); // set pointer to start of new line
+      g_ctx->includeFileOffset = QMIN(l,o+1); // set pointer to start of new line
       break;
   }
 }
@@ -2081,31 +2254,31 @@ void DocCopy::parse(QList<DocNode> &children)
   Definition *def;
   if (findDocsForMemberOrCompound(m_link,&doc,&brief,&def))
   {
-    if (g_copyStack.findRef(def)==-1) // definition not parsed earlier
+    if (g_ctx->copyStack.findRef(def)==-1) // definition not parsed earlier
     {
-      bool         hasParamCommand  = g_hasParamCommand;
-      bool         hasReturnCommand = g_hasReturnCommand;
-      QDict<void>  paramsFound      = g_paramsFound;
+      bool         hasParamCommand  = g_ctx->hasParamCommand;
+      bool         hasReturnCommand = g_ctx->hasReturnCommand;
+      QDict<void>  paramsFound      = g_ctx->paramsFound;
       //printf("..1 hasParamCommand=%d hasReturnCommand=%d paramsFound=%d\n",
-      //      g_hasParamCommand,g_hasReturnCommand,g_paramsFound.count());
+      //      g_ctx->hasParamCommand,g_ctx->hasReturnCommand,g_ctx->paramsFound.count());
 
-      docParserPushContext(FALSE);
-      g_scope = def;
+      docParserPushContext();
+      g_ctx->scope = def;
       if (def->definitionType()==Definition::TypeMember && def->getOuterScope())
       {
         if (def->getOuterScope()!=Doxygen::globalScope)
         {
-          g_context=def->getOuterScope()->name();
+          g_ctx->context=def->getOuterScope()->name();
         }
       }
       else if (def!=Doxygen::globalScope)
       {
-        g_context=def->name();
+        g_ctx->context=def->name();
       }
-      g_styleStack.clear();
-      g_nodeStack.clear();
-      g_paramsFound.clear();
-      g_copyStack.append(def);
+      g_ctx->styleStack.clear();
+      g_ctx->nodeStack.clear();
+      g_ctx->paramsFound.clear();
+      g_ctx->copyStack.append(def);
       // make sure the descriptions end with a newline, so the parser will correctly
       // handle them in all cases.
       //printf("doc='%s'\n",doc.data());
@@ -2116,10 +2289,10 @@ void DocCopy::parse(QList<DocNode> &children)
         internalValidatingParseDoc(m_parent,children,brief);
 
         //printf("..2 hasParamCommand=%d hasReturnCommand=%d paramsFound=%d\n",
-        //    g_hasParamCommand,g_hasReturnCommand,g_paramsFound.count());
-        hasParamCommand  = hasParamCommand  || g_hasParamCommand;
-        hasReturnCommand = hasReturnCommand || g_hasReturnCommand;
-        QDictIterator<void> it(g_paramsFound);
+        //    g_ctx->hasParamCommand,g_ctx->hasReturnCommand,g_ctx->paramsFound.count());
+        hasParamCommand  = hasParamCommand  || g_ctx->hasParamCommand;
+        hasReturnCommand = hasReturnCommand || g_ctx->hasReturnCommand;
+        QDictIterator<void> it(g_ctx->paramsFound);
         void *item;
         for (;(item=it.current());++it)
         {
@@ -2132,37 +2305,37 @@ void DocCopy::parse(QList<DocNode> &children)
         internalValidatingParseDoc(m_parent,children,doc);
 
         //printf("..3 hasParamCommand=%d hasReturnCommand=%d paramsFound=%d\n",
-        //    g_hasParamCommand,g_hasReturnCommand,g_paramsFound.count());
-        hasParamCommand  = hasParamCommand  || g_hasParamCommand;
-        hasReturnCommand = hasReturnCommand || g_hasReturnCommand;
-        QDictIterator<void> it(g_paramsFound);
+        //    g_ctx->hasParamCommand,g_ctx->hasReturnCommand,g_ctx->paramsFound.count());
+        hasParamCommand  = hasParamCommand  || g_ctx->hasParamCommand;
+        hasReturnCommand = hasReturnCommand || g_ctx->hasReturnCommand;
+        QDictIterator<void> it(g_ctx->paramsFound);
         void *item;
         for (;(item=it.current());++it)
         {
           paramsFound.insert(it.currentKey(),it.current());
         }
       }
-      g_copyStack.remove(def);
-      ASSERT(g_styleStack.isEmpty());
-      ASSERT(g_nodeStack.isEmpty());
+      g_ctx->copyStack.remove(def);
+      ASSERT(g_ctx->styleStack.isEmpty());
+      ASSERT(g_ctx->nodeStack.isEmpty());
       docParserPopContext(TRUE);
 
-      g_hasParamCommand  = hasParamCommand;
-      g_hasReturnCommand = hasReturnCommand;
-      g_paramsFound      = paramsFound;
+      g_ctx->hasParamCommand  = hasParamCommand;
+      g_ctx->hasReturnCommand = hasReturnCommand;
+      g_ctx->paramsFound      = paramsFound;
 
       //printf("..4 hasParamCommand=%d hasReturnCommand=%d paramsFound=%d\n",
-      //      g_hasParamCommand,g_hasReturnCommand,g_paramsFound.count());
+      //      g_ctx->hasParamCommand,g_ctx->hasReturnCommand,g_ctx->paramsFound.count());
     }
     else // oops, recursion
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"recursive call chain of \\copydoc commands detected at %d\n",
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"recursive call chain of \\copydoc commands detected at %d\n",
           doctokenizerYYlineno);
     }
   }
   else
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"target %s of \\copydoc command not found",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"target %s of \\copydoc command not found",
         qPrint(m_link));
   }
 }
@@ -2170,7 +2343,7 @@ void DocCopy::parse(QList<DocNode> &children)
 //---------------------------------------------------------------------------
 
 DocXRefItem::DocXRefItem(DocNode *parent,int id,const char *key) : 
-   m_id(id), m_key(key), m_relPath(g_relPath)
+   m_id(id), m_key(key), m_relPath(g_ctx->relPath)
 {
    m_parent = parent; 
 }
@@ -2192,7 +2365,7 @@ bool DocXRefItem::parse()
     ASSERT(item!=0);
     if (item)
     {
-      if (g_memberDef && g_memberDef->name().at(0)=='@')
+      if (g_ctx->memberDef && g_ctx->memberDef->name().at(0)=='@')
       {
         m_file   = "@";  // can't cross reference anonymous enum
         m_anchor = "@";
@@ -2221,7 +2394,7 @@ bool DocXRefItem::parse()
 //---------------------------------------------------------------------------
 
 DocFormula::DocFormula(DocNode *parent,int id) :
-      m_relPath(g_relPath)
+      m_relPath(g_ctx->relPath)
 {
   m_parent = parent; 
   QCString formCmd;
@@ -2235,7 +2408,7 @@ DocFormula::DocFormula(DocNode *parent,int id) :
   }
   else // wrong \form#<n> command
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"Wrong formula id %d",id);
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Wrong formula id %d",id);
     m_id = -1;
   }
 }
@@ -2246,7 +2419,7 @@ DocFormula::DocFormula(DocNode *parent,int id) :
 //{
 //  int retval;
 //  DBG(("DocLanguage::parse() start\n"));
-//  g_nodeStack.push(this);
+//  g_ctx->nodeStack.push(this);
 //
 //  // parse one or more paragraphs
 //  bool isFirst=TRUE;
@@ -2262,7 +2435,7 @@ DocFormula::DocFormula(DocNode *parent,int id) :
 //  if (par) par->markLast();
 //
 //  DBG(("DocLanguage::parse() end\n"));
-//  DocNode *n = g_nodeStack.pop();
+//  DocNode *n = g_ctx->nodeStack.pop();
 //  ASSERT(n==this);
 //  return retval;
 //}
@@ -2272,7 +2445,7 @@ DocFormula::DocFormula(DocNode *parent,int id) :
 void DocSecRefItem::parse()
 {
   DBG(("DocSecRefItem::parse() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   doctokenizerYYsetStateTitle();
   int tok;
@@ -2283,15 +2456,15 @@ void DocSecRefItem::parse()
       switch (tok)
       {
         case TK_COMMAND: 
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\refitem",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\refitem",
 	       qPrint(g_token->name));
           break;
         case TK_SYMBOL: 
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
                qPrint(g_token->name));
           break;
         default:
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
 	       tokToString(tok));
           break;
       }
@@ -2308,24 +2481,24 @@ void DocSecRefItem::parse()
     {
       m_file   = sec->fileName;
       m_anchor = sec->label;
-      if (g_sectionDict && g_sectionDict->find(m_target)==0)
+      if (g_ctx->sectionDict && g_ctx->sectionDict->find(m_target)==0)
       {
-        g_sectionDict->append(m_target,sec);
+        g_ctx->sectionDict->append(m_target,sec);
       }
     }
     else
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"reference to unknown section %s",
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"reference to unknown section %s",
           qPrint(m_target));
     }
   } 
   else
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"reference to empty target");
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"reference to empty target");
   }
   
   DBG(("DocSecRefItem::parse() end\n"));
-  DocNode *n = g_nodeStack.pop();
+  DocNode *n = g_ctx->nodeStack.pop();
   ASSERT(n==this);
 }
 
@@ -2334,7 +2507,7 @@ void DocSecRefItem::parse()
 void DocSecRefList::parse()
 {
   DBG(("DocSecRefList::parse() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   int tok=doctokenizerYYlex();
   // skip white space
@@ -2351,13 +2524,13 @@ void DocSecRefList::parse()
             int tok=doctokenizerYYlex();
             if (tok!=TK_WHITESPACE)
             {
-              warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after \\refitem command");
+              warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after \\refitem command");
               break;
             }
             tok=doctokenizerYYlex();
             if (tok!=TK_WORD && tok!=TK_LNKWORD)
             {
-              warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of \\refitem",
+              warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of \\refitem",
                   tokToString(tok));
               break;
             }
@@ -2370,7 +2543,7 @@ void DocSecRefList::parse()
         case CMD_ENDSECREFLIST:
           goto endsecreflist;
         default:
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\secreflist",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\secreflist",
               qPrint(g_token->name));
           goto endsecreflist;
       }
@@ -2381,7 +2554,7 @@ void DocSecRefList::parse()
     }
     else
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s inside section reference list",
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s inside section reference list",
           tokToString(tok));
       goto endsecreflist;
     }
@@ -2390,14 +2563,14 @@ void DocSecRefList::parse()
 
 endsecreflist:
   DBG(("DocSecRefList::parse() end\n"));
-  DocNode *n = g_nodeStack.pop();
+  DocNode *n = g_ctx->nodeStack.pop();
   ASSERT(n==this);
 }
 
 //---------------------------------------------------------------------------
 
 DocInternalRef::DocInternalRef(DocNode *parent,const QCString &ref) 
-  : m_relPath(g_relPath)
+  : m_relPath(g_ctx->relPath)
 {
   m_parent = parent; 
   int i=ref.find('#');
@@ -2414,7 +2587,7 @@ DocInternalRef::DocInternalRef(DocNode *parent,const QCString &ref)
 
 void DocInternalRef::parse()
 {
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocInternalRef::parse() start\n"));
 
   int tok;
@@ -2425,15 +2598,15 @@ void DocInternalRef::parse()
       switch (tok)
       {
         case TK_COMMAND: 
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\ref",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\ref",
 	       qPrint(g_token->name));
           break;
         case TK_SYMBOL: 
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
                qPrint(g_token->name));
           break;
         default:
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
 		tokToString(tok));
           break;
       }
@@ -2442,7 +2615,7 @@ void DocInternalRef::parse()
 
   handlePendingStyleCommands(this,m_children);
   DBG(("DocInternalRef::parse() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
 }
 
@@ -2457,7 +2630,7 @@ DocRef::DocRef(DocNode *parent,const QCString &target,const QCString &context) :
   //printf("DocRef::DocRef(target=%s,context=%s)\n",target.data(),context.data());
   ASSERT(!target.isEmpty());
   SrcLangExt lang = getLanguageFromFileName(target);
-  m_relPath = g_relPath;
+  m_relPath = g_ctx->relPath;
   SectionInfo *sec = Doxygen::sectionDict->find(target);
   if (sec==0 && lang==SrcLangExt_Markdown) // lookup as markdown file
   {
@@ -2515,8 +2688,8 @@ DocRef::DocRef(DocNode *parent,const QCString &target,const QCString &context) :
       {
         // Objective C Method
         MemberDef *member = (MemberDef*)compound;
-        bool localLink = g_memberDef ? member->getClassDef()==g_memberDef->getClassDef() : FALSE;
-        m_text = member->objCMethodName(localLink,g_inSeeBlock);
+        bool localLink = g_ctx->memberDef ? member->getClassDef()==g_ctx->memberDef->getClassDef() : FALSE;
+        m_text = member->objCMethodName(localLink,g_ctx->inSeeBlock);
       }
 
       m_file = compound->getOutputFileBase();
@@ -2535,7 +2708,7 @@ DocRef::DocRef(DocNode *parent,const QCString &target,const QCString &context) :
     }
   }
   m_text = target;
-  warn_doc_error(g_fileName,doctokenizerYYlineno,"unable to resolve reference to `%s' for \\ref command",
+  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unable to resolve reference to `%s' for \\ref command",
            qPrint(target)); 
 }
 
@@ -2570,7 +2743,7 @@ static void flattenParagraphs(DocNode *root,QList<DocNode> &children)
 
 void DocRef::parse()
 {
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocRef::parse() start\n"));
 
   int tok;
@@ -2581,17 +2754,17 @@ void DocRef::parse()
       switch (tok)
       {
         case TK_COMMAND: 
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\ref",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\ref",
 	       qPrint(g_token->name));
           break;
         case TK_SYMBOL: 
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
                qPrint(g_token->name));
           break;
         case TK_HTMLTAG:
           break;
         default:
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
 		tokToString(tok));
           break;
       }
@@ -2600,17 +2773,17 @@ void DocRef::parse()
 
   if (m_children.isEmpty() && !m_text.isEmpty())
   {
-    g_insideHtmlLink=TRUE;
+    g_ctx->insideHtmlLink=TRUE;
     docParserPushContext();
     internalValidatingParseDoc(this,m_children,m_text);
     docParserPopContext();
-    g_insideHtmlLink=FALSE;
+    g_ctx->insideHtmlLink=FALSE;
     flattenParagraphs(this,m_children);
   }
 
   handlePendingStyleCommands(this,m_children);
   
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
 }
 
@@ -2622,7 +2795,7 @@ DocCite::DocCite(DocNode *parent,const QCString &target,const QCString &) //cont
   m_parent = parent;
   //printf("DocCite::DocCite(target=%s)\n",target.data());
   ASSERT(!target.isEmpty());
-  m_relPath = g_relPath;
+  m_relPath = g_ctx->relPath;
   CiteInfo *cite = Doxygen::citeDict->find(target);
   //printf("cite=%p text='%s' numBibFiles=%d\n",cite,cite?cite->text.data():"<null>",numBibFiles);
   if (numBibFiles>0 && cite && !cite->text.isEmpty()) // ref to citation
@@ -2638,16 +2811,16 @@ DocCite::DocCite(DocNode *parent,const QCString &target,const QCString &) //cont
   m_text = target;
   if (numBibFiles==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"\\cite command found but no bib files specified via CITE_BIB_FILES!");
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"\\cite command found but no bib files specified via CITE_BIB_FILES!");
   }
   else if (cite==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unable to resolve reference to `%s' for \\cite command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unable to resolve reference to `%s' for \\cite command",
              qPrint(target));
   }
   else
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"\\cite command to '%s' does not have an associated number",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"\\cite command to '%s' does not have an associated number",
              qPrint(target));
   }
 }
@@ -2660,12 +2833,12 @@ DocLink::DocLink(DocNode *parent,const QCString &target)
   Definition *compound = 0;
   QCString anchor;
   m_refText = target;
-  m_relPath = g_relPath;
+  m_relPath = g_ctx->relPath;
   if (!m_refText.isEmpty() && m_refText.at(0)=='#')
   {
     m_refText = m_refText.right(m_refText.length()-1);
   }
-  if (resolveLink(g_context,stripKnownExtensions(target),g_inSeeBlock,
+  if (resolveLink(g_ctx->context,stripKnownExtensions(target),g_ctx->inSeeBlock,
                   &compound,anchor))
   {
     m_anchor = anchor;
@@ -2685,7 +2858,7 @@ DocLink::DocLink(DocNode *parent,const QCString &target)
   }
 
   // bogus link target
-  warn_doc_error(g_fileName,doctokenizerYYlineno,"unable to resolve link to `%s' for \\link command",
+  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unable to resolve link to `%s' for \\link command",
          qPrint(target)); 
 }
 
@@ -2693,7 +2866,7 @@ DocLink::DocLink(DocNode *parent,const QCString &target)
 QCString DocLink::parse(bool isJavaLink,bool isXmlLink)
 {
   QCString result;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocLink::parse() start\n"));
 
   int tok;
@@ -2709,23 +2882,23 @@ QCString DocLink::parse(bool isJavaLink,bool isXmlLink)
             case CMD_ENDLINK:
               if (isJavaLink)
               {
-                warn_doc_error(g_fileName,doctokenizerYYlineno,"{@link.. ended with @endlink command");
+                warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"{@link.. ended with @endlink command");
               }
               goto endlink;
             default:
-              warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\link",
+              warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\link",
                   qPrint(g_token->name));
               break;
           }
           break;
         case TK_SYMBOL: 
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
               qPrint(g_token->name));
           break;
         case TK_HTMLTAG:
           if (g_token->name!="see" || !isXmlLink)
           {
-            warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected xml/html command %s found",
+            warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected xml/html command %s found",
                 qPrint(g_token->name));
           }
           goto endlink;
@@ -2753,7 +2926,7 @@ QCString DocLink::parse(bool isJavaLink,bool isXmlLink)
           m_children.append(new DocWord(this,g_token->name));
           break;
         default:
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
              tokToString(tok));
         break;
       }
@@ -2761,7 +2934,7 @@ QCString DocLink::parse(bool isJavaLink,bool isXmlLink)
   }
   if (tok==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected end of comment while inside"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected end of comment while inside"
            " link command\n"); 
   }
 endlink:
@@ -2773,7 +2946,7 @@ endlink:
 
   handlePendingStyleCommands(this,m_children);
   DBG(("DocLink::parse() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return result;
 }
@@ -2782,7 +2955,7 @@ endlink:
 //---------------------------------------------------------------------------
 
 DocDotFile::DocDotFile(DocNode *parent,const QCString &name,const QCString &context) : 
-      m_name(name), m_relPath(g_relPath), m_context(context)
+      m_name(name), m_relPath(g_ctx->relPath), m_context(context)
 {
   m_parent = parent; 
 }
@@ -2803,20 +2976,20 @@ void DocDotFile::parse()
   }
   else if (ambig)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"included dot file name %s is ambiguous.\n"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"included dot file name %s is ambiguous.\n"
            "Possible candidates:\n%s",qPrint(m_name),
            qPrint(showFileDefMatches(Doxygen::exampleNameDict,m_name))
           );
   }
   else
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"included dot file %s is not found "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"included dot file %s is not found "
            "in any of the paths specified via DOTFILE_DIRS!",qPrint(m_name));
   }
 }
 
 DocMscFile::DocMscFile(DocNode *parent,const QCString &name,const QCString &context) : 
-      m_name(name), m_relPath(g_relPath), m_context(context)
+      m_name(name), m_relPath(g_ctx->relPath), m_context(context)
 {
   m_parent = parent; 
 }
@@ -2837,14 +3010,14 @@ void DocMscFile::parse()
   }
   else if (ambig)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"included msc file name %s is ambiguous.\n"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"included msc file name %s is ambiguous.\n"
            "Possible candidates:\n%s",qPrint(m_name),
            qPrint(showFileDefMatches(Doxygen::exampleNameDict,m_name))
           );
   }
   else
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"included msc file %s is not found "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"included msc file %s is not found "
            "in any of the paths specified via MSCFILE_DIRS!",qPrint(m_name));
   }
 }
@@ -2852,7 +3025,7 @@ void DocMscFile::parse()
 //---------------------------------------------------------------------------
 
 DocDiaFile::DocDiaFile(DocNode *parent,const QCString &name,const QCString &context) :
-      m_name(name), m_relPath(g_relPath), m_context(context)
+      m_name(name), m_relPath(g_ctx->relPath), m_context(context)
 {
   m_parent = parent;
 }
@@ -2873,14 +3046,14 @@ void DocDiaFile::parse()
   }
   else if (ambig)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"included dia file name %s is ambiguous.\n"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"included dia file name %s is ambiguous.\n"
            "Possible candidates:\n%s",qPrint(m_name),
            qPrint(showFileDefMatches(Doxygen::exampleNameDict,m_name))
           );
   }
   else
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"included dia file %s is not found "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"included dia file %s is not found "
            "in any of the paths specified via DIAFILE_DIRS!",qPrint(m_name));
   }
 }
@@ -2894,7 +3067,7 @@ DocVhdlFlow::DocVhdlFlow(DocNode *parent)
 
 void DocVhdlFlow::parse()
 {
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocVhdlFlow::parse() start\n"));
 
   doctokenizerYYsetStateTitle();
@@ -2906,15 +3079,15 @@ void DocVhdlFlow::parse()
       switch (tok)
       {
         case TK_COMMAND: 
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\vhdlflow",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a \\vhdlflow",
 	       qPrint(g_token->name));
           break;
         case TK_SYMBOL: 
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
                qPrint(g_token->name));
           break;
         default:
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
 		tokToString(tok));
           break;
       }
@@ -2926,9 +3099,9 @@ void DocVhdlFlow::parse()
   handlePendingStyleCommands(this,m_children);
 
   DBG(("DocVhdlFlow::parse() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
-  VhdlDocGen::createFlowChart(g_memberDef);
+  VhdlDocGen::createFlowChart(g_ctx->memberDef);
 }
 
 
@@ -2937,7 +3110,7 @@ void DocVhdlFlow::parse()
 DocImage::DocImage(DocNode *parent,const HtmlAttribList &attribs,const QCString &name,
                    Type t,const QCString &url) : 
       m_attribs(attribs), m_name(name), 
-      m_type(t), m_relPath(g_relPath),
+      m_type(t), m_relPath(g_ctx->relPath),
       m_url(url)
 {
   m_parent = parent;
@@ -2954,7 +3127,7 @@ void DocImage::parse()
 int DocHtmlHeader::parse()
 {
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHtmlHeader::parse() start\n"));
 
   int tok;
@@ -2965,7 +3138,7 @@ int DocHtmlHeader::parse()
       switch (tok)
       {
         case TK_COMMAND: 
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a <h%d> tag",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a <h%d> tag",
 	       qPrint(g_token->name),m_level);
           break;
         case TK_HTMLTAG:
@@ -2975,7 +3148,7 @@ int DocHtmlHeader::parse()
             {
               if (m_level!=1)
               {
-                warn_doc_error(g_fileName,doctokenizerYYlineno,"<h%d> ended with </h1>",
+                warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"<h%d> ended with </h1>",
                     m_level); 
               }
               goto endheader;
@@ -2984,7 +3157,7 @@ int DocHtmlHeader::parse()
             {
               if (m_level!=2)
               {
-                warn_doc_error(g_fileName,doctokenizerYYlineno,"<h%d> ended with </h2>",
+                warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"<h%d> ended with </h2>",
                     m_level); 
               }
               goto endheader;
@@ -2993,7 +3166,7 @@ int DocHtmlHeader::parse()
             {
               if (m_level!=3)
               {
-                warn_doc_error(g_fileName,doctokenizerYYlineno,"<h%d> ended with </h3>",
+                warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"<h%d> ended with </h3>",
                     m_level); 
               }
               goto endheader;
@@ -3002,7 +3175,7 @@ int DocHtmlHeader::parse()
             {
               if (m_level!=4)
               {
-                warn_doc_error(g_fileName,doctokenizerYYlineno,"<h%d> ended with </h4>",
+                warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"<h%d> ended with </h4>",
                     m_level); 
               }
               goto endheader;
@@ -3011,7 +3184,7 @@ int DocHtmlHeader::parse()
             {
               if (m_level!=5)
               {
-                warn_doc_error(g_fileName,doctokenizerYYlineno,"<h%d> ended with </h5>",
+                warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"<h%d> ended with </h5>",
                     m_level); 
               }
               goto endheader;
@@ -3020,7 +3193,7 @@ int DocHtmlHeader::parse()
             {
               if (m_level!=6)
               {
-                warn_doc_error(g_fileName,doctokenizerYYlineno,"<h%d> ended with </h6>",
+                warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"<h%d> ended with </h6>",
                     m_level); 
               }
               goto endheader;
@@ -3039,18 +3212,18 @@ int DocHtmlHeader::parse()
             }
             else
             {
-              warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected html tag <%s%s> found within <h%d> context",
+              warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected html tag <%s%s> found within <h%d> context",
                   g_token->endTag?"/":"",qPrint(g_token->name),m_level);
             }
             
           }
           break;
         case TK_SYMBOL: 
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
                qPrint(g_token->name));
           break;
         default:
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
 		tokToString(tok));
           break;
       }
@@ -3058,13 +3231,13 @@ int DocHtmlHeader::parse()
   }
   if (tok==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected end of comment while inside"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected end of comment while inside"
            " <h%d> tag\n",m_level); 
   }
 endheader:
   handlePendingStyleCommands(this,m_children);
   DBG(("DocHtmlHeader::parse() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -3074,7 +3247,7 @@ endheader:
 int DocHRef::parse()
 {
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHRef::parse() start\n"));
 
   int tok;
@@ -3085,11 +3258,11 @@ int DocHRef::parse()
       switch (tok)
       {
         case TK_COMMAND: 
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a <a>..</a> block",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a <a>..</a> block",
 	       qPrint(g_token->name));
           break;
         case TK_SYMBOL: 
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
                qPrint(g_token->name));
           break;
         case TK_HTMLTAG:
@@ -3102,13 +3275,13 @@ int DocHRef::parse()
             }
             else
             {
-              warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected html tag <%s%s> found within <a href=...> context",
+              warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected html tag <%s%s> found within <a href=...> context",
                   g_token->endTag?"/":"",qPrint(g_token->name),doctokenizerYYlineno);
             }
           }
           break;
         default:
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
 		tokToString(tok),doctokenizerYYlineno);
           break;
       }
@@ -3116,13 +3289,13 @@ int DocHRef::parse()
   }
   if (tok==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected end of comment while inside"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected end of comment while inside"
            " <a href=...> tag",doctokenizerYYlineno); 
   }
 endhref:
   handlePendingStyleCommands(this,m_children);
   DBG(("DocHRef::parse() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -3132,7 +3305,7 @@ endhref:
 int DocInternal::parse(int level)
 {
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocInternal::parse() start\n"));
 
   // first parse any number of paragraphs
@@ -3154,7 +3327,7 @@ int DocInternal::parse(int level)
     }
     if (retval==TK_LISTITEM)
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Invalid list item found",doctokenizerYYlineno);
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Invalid list item found",doctokenizerYYlineno);
     }
   } while (retval!=0 && 
            retval!=RetVal_Section &&
@@ -3180,11 +3353,11 @@ int DocInternal::parse(int level)
 
   if (retval==RetVal_Internal)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"\\internal command found inside internal section");
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"\\internal command found inside internal section");
   }
 
   DBG(("DocInternal::parse() end: retval=%x\n",retval));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -3194,12 +3367,12 @@ int DocInternal::parse(int level)
 int DocIndexEntry::parse()
 {
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocIndexEntry::parse() start\n"));
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after \\addindex command");
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after \\addindex command");
     goto endindexentry;
   }
   doctokenizerYYsetStateTitle();
@@ -3237,7 +3410,7 @@ int DocIndexEntry::parse()
             case DocSymbol::Sym_ndash:   m_entry+="--";  break;
             case DocSymbol::Sym_mdash:   m_entry+="---";  break;
             default:
-              warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected symbol found as argument of \\addindex");
+              warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected symbol found as argument of \\addindex");
               break;
           }
         }
@@ -3261,13 +3434,13 @@ int DocIndexEntry::parse()
         case CMD_PLUS:    m_entry+='+';  break;
         case CMD_MINUS:   m_entry+='-';  break;
         default:
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected command %s found as argument of \\addindex",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected command %s found as argument of \\addindex",
                     qPrint(g_token->name));
           break;
       }
       break;
       default:
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
             tokToString(tok));
         break;
     }
@@ -3276,7 +3449,7 @@ int DocIndexEntry::parse()
   m_entry = m_entry.stripWhiteSpace();
 endindexentry:
   DBG(("DocIndexEntry::parse() end retval=%x\n",retval));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -3299,15 +3472,15 @@ DocHtmlCaption::DocHtmlCaption(DocNode *parent,const HtmlAttribList &attribs)
         m_file   = sec->fileName;
         m_anchor = sec->label;
         m_hasCaptionId = TRUE;
-        if (g_sectionDict && g_sectionDict->find(opt->value)==0)
+        if (g_ctx->sectionDict && g_ctx->sectionDict->find(opt->value)==0)
         {
           //printf("Inserting in dictionary!\n");
-          g_sectionDict->append(opt->value,sec);
+          g_ctx->sectionDict->append(opt->value,sec);
         }
       }
       else
       {
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"Invalid caption id `%s'",qPrint(opt->value));
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Invalid caption id `%s'",qPrint(opt->value));
       }
     }
     else // copy attribute
@@ -3321,7 +3494,7 @@ DocHtmlCaption::DocHtmlCaption(DocNode *parent,const HtmlAttribList &attribs)
 int DocHtmlCaption::parse()
 {
   int retval=0;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHtmlCaption::parse() start\n"));
   int tok;
   while ((tok=doctokenizerYYlex()))
@@ -3331,11 +3504,11 @@ int DocHtmlCaption::parse()
       switch (tok)
       {
         case TK_COMMAND: 
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a <caption> tag",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a <caption> tag",
               qPrint(g_token->name));
           break;
         case TK_SYMBOL: 
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
               qPrint(g_token->name));
           break;
         case TK_HTMLTAG:
@@ -3348,13 +3521,13 @@ int DocHtmlCaption::parse()
             }
             else
             {
-              warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected html tag <%s%s> found within <caption> context",
+              warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected html tag <%s%s> found within <caption> context",
                   g_token->endTag?"/":"",qPrint(g_token->name));
             }
           }
           break;
         default:
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
               tokToString(tok));
           break;
       }
@@ -3362,13 +3535,13 @@ int DocHtmlCaption::parse()
   }
   if (tok==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected end of comment while inside"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected end of comment while inside"
            " <caption> tag",doctokenizerYYlineno); 
   }
 endcaption:
   handlePendingStyleCommands(this,m_children);
   DBG(("DocHtmlCaption::parse() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -3378,7 +3551,7 @@ endcaption:
 int DocHtmlCell::parse()
 {
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHtmlCell::parse() start\n"));
 
   // parse one or more paragraphs
@@ -3407,7 +3580,7 @@ int DocHtmlCell::parse()
   if (par) par->markLast();
 
   DBG(("DocHtmlCell::parse() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -3415,7 +3588,7 @@ int DocHtmlCell::parse()
 int DocHtmlCell::parseXml()
 {
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHtmlCell::parseXml() start\n"));
 
   // parse one or more paragraphs
@@ -3444,7 +3617,7 @@ int DocHtmlCell::parseXml()
   if (par) par->markLast();
 
   DBG(("DocHtmlCell::parseXml() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -3505,7 +3678,7 @@ DocHtmlCell::Alignment DocHtmlCell::alignment() const
 int DocHtmlRow::parse()
 {
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHtmlRow::parse() start\n"));
 
   bool isHeading=FALSE;
@@ -3529,7 +3702,7 @@ int DocHtmlRow::parse()
     }
     else // found some other tag
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <td> or <th> tag but "
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <td> or <th> tag but "
           "found <%s> instead!",qPrint(g_token->name));
       doctokenizerYYpushBackHtmlTag(g_token->name);
       goto endrow;
@@ -3537,13 +3710,13 @@ int DocHtmlRow::parse()
   }
   else if (tok==0) // premature end of comment
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
         " for a html description title");
     goto endrow;
   }
   else // token other than html token
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <td> or <th> tag but found %s token instead!",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <td> or <th> tag but found %s token instead!",
         tokToString(tok));
     goto endrow;
   }
@@ -3563,7 +3736,7 @@ int DocHtmlRow::parse()
 
 endrow:
   DBG(("DocHtmlRow::parse() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -3571,7 +3744,7 @@ endrow:
 int DocHtmlRow::parseXml(bool isHeading)
 {
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHtmlRow::parseXml() start\n"));
 
   bool isFirst=TRUE;
@@ -3593,7 +3766,7 @@ int DocHtmlRow::parseXml(bool isHeading)
     }
     else // found some other tag
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <term> or <description> tag but "
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <term> or <description> tag but "
           "found <%s> instead!",qPrint(g_token->name));
       doctokenizerYYpushBackHtmlTag(g_token->name);
       goto endrow;
@@ -3601,13 +3774,13 @@ int DocHtmlRow::parseXml(bool isHeading)
   }
   else if (tok==0) // premature end of comment
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
         " for a html description title");
     goto endrow;
   }
   else // token other than html token
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <td> or <th> tag but found %s token instead!",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <td> or <th> tag but found %s token instead!",
         tokToString(tok));
     goto endrow;
   }
@@ -3625,7 +3798,7 @@ int DocHtmlRow::parseXml(bool isHeading)
 
 endrow:
   DBG(("DocHtmlRow::parseXml() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -3635,7 +3808,7 @@ endrow:
 int DocHtmlTable::parse()
 {
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHtmlTable::parse() start\n"));
   
 getrow:
@@ -3656,7 +3829,7 @@ getrow:
     {
       if (m_caption)
       {
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"table already has a caption, found another one");
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"table already has a caption, found another one");
       }
       else
       {
@@ -3671,18 +3844,18 @@ getrow:
     }
     else // found wrong token
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <tr> or <caption> tag but "
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <tr> or <caption> tag but "
           "found <%s%s> instead!", g_token->endTag ? "/" : "", qPrint(g_token->name));
     }
   }
   else if (tok==0) // premature end of comment
   {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
           " for a <tr> or <caption> tag");
   }
   else // token other than html token
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <tr> tag but found %s token instead!",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <tr> tag but found %s token instead!",
         tokToString(tok));
   }
        
@@ -3697,7 +3870,7 @@ getrow:
   computeTableGrid();
 
   DBG(("DocHtmlTable::parse() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval==RetVal_EndTable ? RetVal_OK : retval;
 }
@@ -3705,7 +3878,7 @@ getrow:
 int DocHtmlTable::parseXml()
 {
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHtmlTable::parseXml() start\n"));
   
   // get next token
@@ -3741,7 +3914,7 @@ int DocHtmlTable::parseXml()
   computeTableGrid();
 
   DBG(("DocHtmlTable::parseXml() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   tagId=Mappers::htmlTagMapper->map(g_token->name);
   return tagId==XML_LIST && g_token->endTag ? RetVal_OK : retval;
@@ -3839,7 +4012,7 @@ void DocHtmlTable::accept(DocVisitor *v)
 int DocHtmlDescTitle::parse()
 {
   int retval=0;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHtmlDescTitle::parse() start\n"));
 
   int tok;
@@ -3860,7 +4033,7 @@ int DocHtmlDescTitle::parse()
                   int tok=doctokenizerYYlex();
                   if (tok!=TK_WHITESPACE)
                   {
-                    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+                    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
                         qPrint(g_token->name));
                   }
                   else
@@ -3869,12 +4042,12 @@ int DocHtmlDescTitle::parse()
                     tok=doctokenizerYYlex(); // get the reference id
                     if (tok!=TK_WORD)
                     {
-                      warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+                      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
                           tokToString(tok),qPrint(cmdName));
                     }
                     else
                     {
-                      DocRef *ref = new DocRef(this,g_token->name,g_context);
+                      DocRef *ref = new DocRef(this,g_token->name,g_ctx->context);
                       m_children.append(ref);
                       ref->parse();
                     }
@@ -3890,7 +4063,7 @@ int DocHtmlDescTitle::parse()
                   int tok=doctokenizerYYlex();
                   if (tok!=TK_WHITESPACE)
                   {
-                    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+                    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
                         qPrint(cmdName));
                   }
                   else
@@ -3899,7 +4072,7 @@ int DocHtmlDescTitle::parse()
                     tok=doctokenizerYYlex();
                     if (tok!=TK_WORD)
                     {
-                      warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+                      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
                           tokToString(tok),qPrint(cmdName));
                     }
                     else
@@ -3918,13 +4091,13 @@ int DocHtmlDescTitle::parse()
 
                 break;
               default:
-                warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a <dt> tag",
+                warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a <dt> tag",
                                qPrint(g_token->name));
             }
           }
           break;
         case TK_SYMBOL: 
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
               qPrint(g_token->name));
           break;
         case TK_HTMLTAG:
@@ -3959,13 +4132,13 @@ int DocHtmlDescTitle::parse()
             }
             else
             {
-              warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected html tag <%s%s> found within <dt> context",
+              warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected html tag <%s%s> found within <dt> context",
                   g_token->endTag?"/":"",qPrint(g_token->name));
             }
           }
           break;
         default:
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
               tokToString(tok));
           break;
       }
@@ -3973,13 +4146,13 @@ int DocHtmlDescTitle::parse()
   }
   if (tok==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected end of comment while inside"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected end of comment while inside"
         " <dt> tag"); 
   }
 endtitle:
   handlePendingStyleCommands(this,m_children);
   DBG(("DocHtmlDescTitle::parse() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -3990,7 +4163,7 @@ int DocHtmlDescData::parse()
 {
   m_attribs = g_token->attribs;
   int retval=0;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHtmlDescData::parse() start\n"));
 
   bool isFirst=TRUE;
@@ -4006,7 +4179,7 @@ int DocHtmlDescData::parse()
   if (par) par->markLast();
   
   DBG(("DocHtmlDescData::parse() end\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -4016,7 +4189,7 @@ int DocHtmlDescData::parse()
 int DocHtmlDescList::parse()
 {
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DBG(("DocHtmlDescList::parse() start\n"));
 
   // get next token
@@ -4033,7 +4206,7 @@ int DocHtmlDescList::parse()
     }
     else // found some other tag
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <dt> tag but "
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <dt> tag but "
           "found <%s> instead!",qPrint(g_token->name));
       doctokenizerYYpushBackHtmlTag(g_token->name);
       goto enddesclist;
@@ -4041,13 +4214,13 @@ int DocHtmlDescList::parse()
   }
   else if (tok==0) // premature end of comment
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
         " for a html description title");
     goto enddesclist;
   }
   else // token other than html token
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <dt> tag but found %s token instead!",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <dt> tag but found %s token instead!",
         tokToString(tok));
     goto enddesclist;
   }
@@ -4072,12 +4245,12 @@ int DocHtmlDescList::parse()
 
   if (retval==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment while inside <dl> block");
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment while inside <dl> block");
   }
 
 enddesclist:
 
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   DBG(("DocHtmlDescList::parse() end\n"));
   return retval==RetVal_EndDesc ? RetVal_OK : retval;
@@ -4089,7 +4262,7 @@ int DocHtmlListItem::parse()
 {
   DBG(("DocHtmlListItem::parse() start\n"));
   int retval=0;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   // parse one or more paragraphs
   bool isFirst=TRUE;
@@ -4104,7 +4277,7 @@ int DocHtmlListItem::parse()
   while (retval==TK_NEWPARA);
   if (par) par->markLast();
 
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   DBG(("DocHtmlListItem::parse() end retval=%x\n",retval));
   return retval;
@@ -4114,7 +4287,7 @@ int DocHtmlListItem::parseXml()
 {
   DBG(("DocHtmlListItem::parseXml() start\n"));
   int retval=0;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   // parse one or more paragraphs
   bool isFirst=TRUE;
@@ -4138,7 +4311,7 @@ int DocHtmlListItem::parseXml()
 
   if (par) par->markLast();
 
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   DBG(("DocHtmlListItem::parseXml() end retval=%x\n",retval));
   return retval;
@@ -4151,7 +4324,7 @@ int DocHtmlList::parse()
   DBG(("DocHtmlList::parse() start\n"));
   int retval=RetVal_OK;
   int num=1;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   // get next token
   int tok=doctokenizerYYlex();
@@ -4172,7 +4345,7 @@ int DocHtmlList::parse()
     {
       // add dummy item to obtain valid HTML
       m_children.append(new DocHtmlListItem(this,HtmlAttribList(),1));
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"empty list!");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"empty list!");
       retval = RetVal_EndList;
       goto endlist;
     }
@@ -4180,7 +4353,7 @@ int DocHtmlList::parse()
     {
       // add dummy item to obtain valid HTML
       m_children.append(new DocHtmlListItem(this,HtmlAttribList(),1));
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <li> tag but "
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <li> tag but "
           "found <%s%s> instead!",g_token->endTag?"/":"",qPrint(g_token->name));
       doctokenizerYYpushBackHtmlTag(g_token->name);
       goto endlist;
@@ -4190,7 +4363,7 @@ int DocHtmlList::parse()
   {
     // add dummy item to obtain valid HTML
     m_children.append(new DocHtmlListItem(this,HtmlAttribList(),1));
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
         " for a html list item");
     goto endlist;
   }
@@ -4198,7 +4371,7 @@ int DocHtmlList::parse()
   {
     // add dummy item to obtain valid HTML
     m_children.append(new DocHtmlListItem(this,HtmlAttribList(),1));
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <li> tag but found %s token instead!",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <li> tag but found %s token instead!",
         tokToString(tok));
     goto endlist;
   }
@@ -4212,13 +4385,13 @@ int DocHtmlList::parse()
   
   if (retval==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment while inside <%cl> block",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment while inside <%cl> block",
         m_type==Unordered ? 'u' : 'o');
   }
 
 endlist:
   DBG(("DocHtmlList::parse() end retval=%x\n",retval));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval==RetVal_EndList ? RetVal_OK : retval;
 }
@@ -4228,7 +4401,7 @@ int DocHtmlList::parseXml()
   DBG(("DocHtmlList::parseXml() start\n"));
   int retval=RetVal_OK;
   int num=1;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   // get next token
   int tok=doctokenizerYYlex();
@@ -4245,7 +4418,7 @@ int DocHtmlList::parseXml()
     }
     else // found some other tag
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <item> tag but "
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <item> tag but "
           "found <%s> instead!",qPrint(g_token->name));
       doctokenizerYYpushBackHtmlTag(g_token->name);
       goto endlist;
@@ -4253,13 +4426,13 @@ int DocHtmlList::parseXml()
   }
   else if (tok==0) // premature end of comment
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment while looking"
         " for a html list item");
     goto endlist;
   }
   else // token other than html token
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected <item> tag but found %s token instead!",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected <item> tag but found %s token instead!",
         tokToString(tok));
     goto endlist;
   }
@@ -4275,13 +4448,13 @@ int DocHtmlList::parseXml()
   
   if (retval==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment while inside <list type=\"%s\"> block",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment while inside <list type=\"%s\"> block",
         m_type==Unordered ? "bullet" : "number");
   }
 
 endlist:
   DBG(("DocHtmlList::parseXml() end retval=%x\n",retval));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval==RetVal_EndList || 
          (retval==RetVal_CloseXml || g_token->name=="list") ? 
@@ -4294,7 +4467,7 @@ int DocHtmlBlockQuote::parse()
 {
   DBG(("DocHtmlBlockQuote::parse() start\n"));
   int retval=0;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   // parse one or more paragraphs 
   bool isFirst=TRUE;
@@ -4309,7 +4482,7 @@ int DocHtmlBlockQuote::parse()
   while (retval==TK_NEWPARA);
   if (par) par->markLast();
 
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   DBG(("DocHtmlBlockQuote::parse() end retval=%x\n",retval));
   return (retval==RetVal_EndBlockQuote) ? RetVal_OK : retval;
@@ -4321,7 +4494,7 @@ int DocParBlock::parse()
 {
   DBG(("DocParBlock::parse() start\n"));
   int retval=0;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   // parse one or more paragraphs 
   bool isFirst=TRUE;
@@ -4336,7 +4509,7 @@ int DocParBlock::parse()
   while (retval==TK_NEWPARA);
   if (par) par->markLast();
 
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   DBG(("DocParBlock::parse() end retval=%x\n",retval));
   return (retval==RetVal_EndBlockQuote) ? RetVal_OK : retval;
@@ -4346,11 +4519,11 @@ int DocParBlock::parse()
 
 int DocSimpleListItem::parse()
 {
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   int rv=m_paragraph->parse();
   m_paragraph->markFirst();
   m_paragraph->markLast();
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return rv;
 }
@@ -4359,7 +4532,7 @@ int DocSimpleListItem::parse()
 
 int DocSimpleList::parse()
 {
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   int rv;
   do
   {
@@ -4367,7 +4540,7 @@ int DocSimpleList::parse()
     m_children.append(li);
     rv=li->parse();
   } while (rv==RetVal_ListItem);
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return (rv!=TK_NEWPARA) ? rv : RetVal_OK;
 }
@@ -4383,7 +4556,7 @@ DocAutoListItem::DocAutoListItem(DocNode *parent,int indent,int num)
 int DocAutoListItem::parse()
 {
   int retval = RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   
   // first parse any number of paragraphs
   bool isFirst=TRUE;
@@ -4408,7 +4581,7 @@ int DocAutoListItem::parse()
   } while (retval==TK_NEWPARA && g_token->indent>m_indent);
   if (lastPar) lastPar->markLast();
 
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   //printf("DocAutoListItem: retval=%d indent=%d\n",retval,g_token->indent);
   return retval;
@@ -4428,7 +4601,7 @@ int DocAutoList::parse()
 {
   int retval = RetVal_OK;
   int num=1;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   doctokenizerYYstartAutoList();
 	  // first item or sub list => create new list
   do
@@ -4453,7 +4626,7 @@ int DocAutoList::parse()
         );
 
   doctokenizerYYendAutoList();
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -4463,7 +4636,7 @@ int DocAutoList::parse()
 void DocTitle::parse()
 {
   DBG(("DocTitle::parse() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   doctokenizerYYsetStateTitle();
   int tok;
   while ((tok=doctokenizerYYlex()))
@@ -4473,15 +4646,15 @@ void DocTitle::parse()
       switch (tok)
       {
         case TK_COMMAND: 
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal command %s as part of a title section",
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal command %s as part of a title section",
 	       qPrint(g_token->name));
           break;
         case TK_SYMBOL: 
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
                qPrint(g_token->name));
           break;
         default:
-	  warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+	  warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
 		tokToString(tok));
           break;
       }
@@ -4490,7 +4663,7 @@ void DocTitle::parse()
   doctokenizerYYsetStatePara();
   handlePendingStyleCommands(this,m_children);
   DBG(("DocTitle::parse() end\n"));
-  DocNode *n = g_nodeStack.pop();
+  DocNode *n = g_ctx->nodeStack.pop();
   ASSERT(n==this);
 }
 
@@ -4526,7 +4699,7 @@ void DocSimpleSect::accept(DocVisitor *v)
 int DocSimpleSect::parse(bool userTitle,bool needsSeparator)
 {
   DBG(("DocSimpleSect::parse() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   // handle case for user defined title
   if (userTitle)
@@ -4554,7 +4727,7 @@ int DocSimpleSect::parse(bool userTitle,bool needsSeparator)
   int retval = par->parse();
 
   DBG(("DocSimpleSect::parse() end retval=%d\n",retval));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval; // 0==EOF, TK_NEWPARA, TK_LISTITEM, TK_ENDLIST, RetVal_SimpleSec
 }
@@ -4562,7 +4735,7 @@ int DocSimpleSect::parse(bool userTitle,bool needsSeparator)
 int DocSimpleSect::parseRcs()
 {
   DBG(("DocSimpleSect::parseRcs() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   m_title = new DocTitle(this);
   m_title->parseFromString(g_token->name);
@@ -4573,7 +4746,7 @@ int DocSimpleSect::parseRcs()
   docParserPopContext(); // this will restore the old g_token
 
   DBG(("DocSimpleSect::parseRcs()\n"));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return RetVal_OK; 
 }
@@ -4581,7 +4754,7 @@ int DocSimpleSect::parseRcs()
 int DocSimpleSect::parseXml()
 {
   DBG(("DocSimpleSect::parse() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   int retval = RetVal_OK;
   for (;;) 
@@ -4611,7 +4784,7 @@ int DocSimpleSect::parseXml()
   }
   
   DBG(("DocSimpleSect::parseXml() end retval=%d\n",retval));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval; 
 }
@@ -4633,9 +4806,9 @@ void DocSimpleSect::appendLinkWord(const QCString &word)
     p->injectToken(TK_WHITESPACE," ");
   }
   
-  g_inSeeBlock=TRUE;
+  g_ctx->inSeeBlock=TRUE;
   p->injectToken(TK_LNKWORD,word);
-  g_inSeeBlock=FALSE;
+  g_ctx->inSeeBlock=FALSE;
 }
 
 QCString DocSimpleSect::typeString() const
@@ -4670,14 +4843,14 @@ int DocParamList::parse(const QCString &cmdName)
 {
   int retval=RetVal_OK;
   DBG(("DocParamList::parse() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   DocPara *par=0;
   QCString saveCmdName = cmdName;
 
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint(cmdName));
     retval=0;
     goto endparamlist;
@@ -4693,19 +4866,19 @@ int DocParamList::parse(const QCString &cmdName)
       {
         handleParameterType(this,m_paramTypes,g_token->name.left(typeSeparator));
         g_token->name = g_token->name.mid(typeSeparator+1);
-        g_hasParamCommand=TRUE;
+        g_ctx->hasParamCommand=TRUE;
         checkArgumentName(g_token->name,TRUE);
         ((DocParamSect*)parent())->m_hasTypeSpecifier=TRUE;
       }
       else
       {
-        g_hasParamCommand=TRUE;
+        g_ctx->hasParamCommand=TRUE;
         checkArgumentName(g_token->name,TRUE);
       }
     }
     else if (m_type==DocParamSect::RetVal)
     {
-      g_hasReturnCommand=TRUE;
+      g_ctx->hasReturnCommand=TRUE;
       checkArgumentName(g_token->name,FALSE);
     }
     //m_params.append(g_token->name);
@@ -4715,14 +4888,14 @@ int DocParamList::parse(const QCString &cmdName)
   doctokenizerYYsetStatePara();
   if (tok==0) /* premature end of comment block */
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
         "argument of command %s",qPrint(cmdName));
     retval=0;
     goto endparamlist;
   }
   if (tok!=TK_WHITESPACE) /* premature end of comment block */
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token in comment block while parsing the "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token in comment block while parsing the "
         "argument of command %s",qPrint(saveCmdName));
     retval=0;
     goto endparamlist;
@@ -4736,7 +4909,7 @@ int DocParamList::parse(const QCString &cmdName)
 
 endparamlist:
   DBG(("DocParamList::parse() end retval=%d\n",retval));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -4745,17 +4918,17 @@ int DocParamList::parseXml(const QCString &paramName)
 {
   int retval=RetVal_OK;
   DBG(("DocParamList::parseXml() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   g_token->name = paramName;
   if (m_type==DocParamSect::Param)
   {
-    g_hasParamCommand=TRUE;
+    g_ctx->hasParamCommand=TRUE;
     checkArgumentName(g_token->name,TRUE);
   }
   else if (m_type==DocParamSect::RetVal)
   {
-    g_hasReturnCommand=TRUE;
+    g_ctx->hasReturnCommand=TRUE;
     checkArgumentName(g_token->name,FALSE);
   }
   
@@ -4795,7 +4968,7 @@ int DocParamList::parseXml(const QCString &paramName)
 
   if (retval==0) /* premature end of comment block */
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unterminated param or exception tag");
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unterminated param or exception tag");
   }
   else
   {
@@ -4804,7 +4977,7 @@ int DocParamList::parseXml(const QCString &paramName)
 
 
   DBG(("DocParamList::parse() end retval=%d\n",retval));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -4815,7 +4988,7 @@ int DocParamSect::parse(const QCString &cmdName,bool xmlContext, Direction d)
 {
   int retval=RetVal_OK;
   DBG(("DocParamSect::parse() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   if (d!=Unspecified)
   {
@@ -4849,7 +5022,7 @@ int DocParamSect::parse(const QCString &cmdName,bool xmlContext, Direction d)
   }
   
   DBG(("DocParamSect::parse() end retval=%d\n",retval));
-  DocNode *n=g_nodeStack.pop();
+  DocNode *n=g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -4914,7 +5087,7 @@ void DocPara::handleCite()
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint("cite"));
     return;
   }
@@ -4922,18 +5095,18 @@ void DocPara::handleCite()
   tok=doctokenizerYYlex();
   if (tok==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
         "argument of command %s\n", qPrint("cite"));
     return;
   }
   else if (tok!=TK_WORD && tok!=TK_LNKWORD)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
         tokToString(tok),qPrint("cite"));
     return;
   }
   g_token->sectionId = g_token->name;
-  DocCite *cite = new DocCite(this,g_token->name,g_context);
+  DocCite *cite = new DocCite(this,g_token->name,g_ctx->context);
   m_children.append(cite);
   //cite->parse();
 
@@ -4968,7 +5141,7 @@ void DocPara::handleIncludeOperator(const QCString &cmdName,DocIncOperator::Type
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint(cmdName));
     return;
   }
@@ -4977,17 +5150,17 @@ void DocPara::handleIncludeOperator(const QCString &cmdName,DocIncOperator::Type
   doctokenizerYYsetStatePara();
   if (tok==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
         "argument of command %s", qPrint(cmdName));
     return;
   }
   else if (tok!=TK_WORD)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
         tokToString(tok),qPrint(cmdName));
     return;
   }
-  DocIncOperator *op = new DocIncOperator(this,t,g_token->name,g_context,g_isExample,g_exampleName);
+  DocIncOperator *op = new DocIncOperator(this,t,g_token->name,g_ctx->context,g_ctx->isExample,g_ctx->exampleName);
   QListIterator<DocNode> it(m_children);
   DocNode *n1 = it.toLast();
   --it;
@@ -5020,21 +5193,21 @@ void DocPara::handleImage(const QCString &cmdName)
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint(cmdName));
     return;
   }
   tok=doctokenizerYYlex();
   if (tok!=TK_WORD && tok!=TK_LNKWORD)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
         tokToString(tok),qPrint(cmdName));
     return;
   }
   tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint(cmdName));
     return;
   }
@@ -5046,7 +5219,7 @@ void DocPara::handleImage(const QCString &cmdName)
   else if (imgType=="rtf")     t=DocImage::Rtf;
   else
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"image type %s specified as the first argument of "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"image type %s specified as the first argument of "
         "%s is not valid",
         qPrint(imgType),qPrint(cmdName));
     return;
@@ -5056,7 +5229,7 @@ void DocPara::handleImage(const QCString &cmdName)
   doctokenizerYYsetStatePara();
   if (tok!=TK_WORD)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
         tokToString(tok),qPrint(cmdName));
     return;
   }
@@ -5072,7 +5245,7 @@ void DocPara::handleFile(const QCString &cmdName)
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint(cmdName));
     return;
   }
@@ -5081,12 +5254,12 @@ void DocPara::handleFile(const QCString &cmdName)
   doctokenizerYYsetStatePara();
   if (tok!=TK_WORD)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
         tokToString(tok),qPrint(cmdName));
     return;
   }
   QCString name = g_token->name;
-  T *df = new T(this,name,g_context);
+  T *df = new T(this,name,g_ctx->context);
   m_children.append(df);
   df->parse();
 }
@@ -5103,7 +5276,7 @@ void DocPara::handleLink(const QCString &cmdName,bool isJavaLink)
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint(cmdName));
     return;
   }
@@ -5111,7 +5284,7 @@ void DocPara::handleLink(const QCString &cmdName,bool isJavaLink)
   tok=doctokenizerYYlex();
   if (tok!=TK_WORD)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"%s as the argument of %s",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"%s as the argument of %s",
         tokToString(tok),qPrint(cmdName));
     return;
   }
@@ -5131,7 +5304,7 @@ void DocPara::handleRef(const QCString &cmdName)
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint(cmdName));
     return;
   }
@@ -5140,11 +5313,11 @@ void DocPara::handleRef(const QCString &cmdName)
   DocRef *ref=0;
   if (tok!=TK_WORD)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
         tokToString(tok),qPrint(cmdName));
     goto endref;
   }
-  ref = new DocRef(this,g_token->name,g_context);
+  ref = new DocRef(this,g_token->name,g_ctx->context);
   m_children.append(ref);
   ref->parse();
 endref:
@@ -5157,7 +5330,7 @@ void DocPara::handleInclude(const QCString &cmdName,DocInclude::Type t)
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint(cmdName));
     return;
   }
@@ -5166,13 +5339,13 @@ void DocPara::handleInclude(const QCString &cmdName,DocInclude::Type t)
   doctokenizerYYsetStatePara();
   if (tok==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
         "argument of command %s",qPrint(cmdName));
     return;
   }
   else if (tok!=TK_WORD)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
         tokToString(tok),qPrint(cmdName));
     return;
   }
@@ -5180,13 +5353,13 @@ void DocPara::handleInclude(const QCString &cmdName,DocInclude::Type t)
   QCString blockId;
   if (t==DocInclude::Snippet || t==DocInclude::SnipWithLines || t==DocInclude::SnippetDoc)
   {
-    if (fileName == "this") fileName=g_fileName;
+    if (fileName == "this") fileName=g_ctx->fileName;
     doctokenizerYYsetStateSnippet();
     tok=doctokenizerYYlex();
     doctokenizerYYsetStatePara();
     if (tok!=TK_WORD)
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"expected block identifier, but found token %s instead while parsing the %s command",
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected block identifier, but found token %s instead while parsing the %s command",
           tokToString(tok),qPrint(cmdName));
       return;
     }
@@ -5202,18 +5375,19 @@ void DocPara::handleInclude(const QCString &cmdName,DocInclude::Type t)
      readTextFileByName(fileName,inc_text);
      if (t==DocInclude::SnippetDoc)
      {
-       inc_line = lineBlock(inc_text, blockId);
-       inc_text = extractBlock(inc_text, blockId);
+       SnippetBlock sb = findSnippet(fileName,inc_text,blockId);
+       inc_line = sb.line;
+       inc_text = inc_text.mid(sb.start,sb.length);
      }
      docParserPushContext();
-     g_fileName = fileName;
+     g_ctx->fileName = fileName;
      doctokenizerYYlineno=inc_line;
      internalValidatingParseDoc(this,m_children,inc_text);
      docParserPopContext();
   }
   else
   {
-    DocInclude *inc = new DocInclude(this,fileName,g_context,t,g_isExample,g_exampleName,blockId);
+    DocInclude *inc = new DocInclude(this,fileName,g_ctx->context,t,g_ctx->isExample,g_ctx->exampleName,blockId);
     m_children.append(inc);
     inc->parse();
   }
@@ -5225,20 +5399,20 @@ void DocPara::handleSection(const QCString &cmdName)
   int tok=doctokenizerYYlex();
   if (tok!=TK_WHITESPACE)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"expected whitespace after %s command",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"expected whitespace after %s command",
         qPrint(cmdName));
     return;
   }
   tok=doctokenizerYYlex();
   if (tok==0)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected end of comment block while parsing the "
         "argument of command %s\n", qPrint(cmdName));
     return;
   }
   else if (tok!=TK_WORD && tok!=TK_LNKWORD)
   {
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected token %s as the argument of %s",
         tokToString(tok),qPrint(cmdName));
     return;
   }
@@ -5273,7 +5447,7 @@ int DocPara::handleStartCode()
   {
     lang="."+lang;
   }
-  if (g_xmlComment)
+  if (g_ctx->xmlComment)
   {
     g_token->verb = substitute(substitute(g_token->verb,"&lt;","<"),"&gt;",">");
   }
@@ -5284,36 +5458,36 @@ int DocPara::handleStartCode()
     if (g_token->verb.at(i)=='\n') li=i+1;
     i++;
   }
-  m_children.append(new DocVerbatim(this,g_context,stripIndentation(g_token->verb.mid(li)),DocVerbatim::Code,g_isExample,g_exampleName,FALSE,lang));
-  if (retval==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"code section ended without end marker");
+  m_children.append(new DocVerbatim(this,g_ctx->context,stripIndentation(g_token->verb.mid(li)),DocVerbatim::Code,g_ctx->isExample,g_ctx->exampleName,FALSE,lang));
+  if (retval==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"code section ended without end marker");
   doctokenizerYYsetStatePara();
   return retval;
 }
 
 void DocPara::handleInheritDoc()
 {
-  if (g_memberDef) // inheriting docs from a member
+  if (g_ctx->memberDef) // inheriting docs from a member
   {
-    MemberDef *reMd = g_memberDef->reimplements();
+    MemberDef *reMd = g_ctx->memberDef->reimplements();
     if (reMd) // member from which was inherited.
     {
-      MemberDef *thisMd = g_memberDef;
-      //printf("{InheritDocs:%s=>%s}\n",g_memberDef->qualifiedName().data(),reMd->qualifiedName().data());
+      MemberDef *thisMd = g_ctx->memberDef;
+      //printf("{InheritDocs:%s=>%s}\n",g_ctx->memberDef->qualifiedName().data(),reMd->qualifiedName().data());
       docParserPushContext();
-      g_scope=reMd->getOuterScope();
-      if (g_scope!=Doxygen::globalScope)
+      g_ctx->scope=reMd->getOuterScope();
+      if (g_ctx->scope!=Doxygen::globalScope)
       {
-        g_context=g_scope->name();
+        g_ctx->context=g_ctx->scope->name();
       }
-      g_memberDef=reMd;
-      g_styleStack.clear();
-      g_nodeStack.clear();
-      g_copyStack.append(reMd);
+      g_ctx->memberDef=reMd;
+      g_ctx->styleStack.clear();
+      g_ctx->nodeStack.clear();
+      g_ctx->copyStack.append(reMd);
       internalValidatingParseDoc(this,m_children,reMd->briefDescription());
       internalValidatingParseDoc(this,m_children,reMd->documentation());
-      g_copyStack.remove(reMd);
+      g_ctx->copyStack.remove(reMd);
       docParserPopContext(TRUE);
-      g_memberDef = thisMd;
+      g_ctx->memberDef = thisMd;
     }
   }
 }
@@ -5327,24 +5501,24 @@ int DocPara::handleCommand(const QCString &cmdName)
   switch (cmdId)
   {
     case CMD_UNKNOWN:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Found unknown command `\\%s'",qPrint(cmdName));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Found unknown command `\\%s'",qPrint(cmdName));
       break;
     case CMD_EMPHASIS:
-      m_children.append(new DocStyleChange(this,g_nodeStack.count(),DocStyleChange::Italic,TRUE));
+      m_children.append(new DocStyleChange(this,g_ctx->nodeStack.count(),DocStyleChange::Italic,TRUE));
       retval=handleStyleArgument(this,m_children,cmdName); 
-      m_children.append(new DocStyleChange(this,g_nodeStack.count(),DocStyleChange::Italic,FALSE));
+      m_children.append(new DocStyleChange(this,g_ctx->nodeStack.count(),DocStyleChange::Italic,FALSE));
       if (retval!=TK_WORD) m_children.append(new DocWhiteSpace(this," "));
       break;
     case CMD_BOLD:
-      m_children.append(new DocStyleChange(this,g_nodeStack.count(),DocStyleChange::Bold,TRUE));
+      m_children.append(new DocStyleChange(this,g_ctx->nodeStack.count(),DocStyleChange::Bold,TRUE));
       retval=handleStyleArgument(this,m_children,cmdName); 
-      m_children.append(new DocStyleChange(this,g_nodeStack.count(),DocStyleChange::Bold,FALSE));
+      m_children.append(new DocStyleChange(this,g_ctx->nodeStack.count(),DocStyleChange::Bold,FALSE));
       if (retval!=TK_WORD) m_children.append(new DocWhiteSpace(this," "));
       break;
     case CMD_CODE:
-      m_children.append(new DocStyleChange(this,g_nodeStack.count(),DocStyleChange::Code,TRUE));
+      m_children.append(new DocStyleChange(this,g_ctx->nodeStack.count(),DocStyleChange::Code,TRUE));
       retval=handleStyleArgument(this,m_children,cmdName); 
-      m_children.append(new DocStyleChange(this,g_nodeStack.count(),DocStyleChange::Code,FALSE));
+      m_children.append(new DocStyleChange(this,g_ctx->nodeStack.count(),DocStyleChange::Code,FALSE));
       if (retval!=TK_WORD) m_children.append(new DocWhiteSpace(this," "));
       break;
     case CMD_BSLASH:
@@ -5399,13 +5573,13 @@ int DocPara::handleCommand(const QCString &cmdName)
       m_children.append(new DocSymbol(this,DocSymbol::Sym_Minus));
       break;
     case CMD_SA:
-      g_inSeeBlock=TRUE;
+      g_ctx->inSeeBlock=TRUE;
       retval = handleSimpleSection(DocSimpleSect::See);
-      g_inSeeBlock=FALSE;
+      g_ctx->inSeeBlock=FALSE;
       break;
     case CMD_RETURN:
       retval = handleSimpleSection(DocSimpleSect::Return);
-      g_hasReturnCommand=TRUE;
+      g_ctx->hasReturnCommand=TRUE;
       break;
     case CMD_AUTHOR:
       retval = handleSimpleSection(DocSimpleSect::Author);
@@ -5490,8 +5664,8 @@ int DocPara::handleCommand(const QCString &cmdName)
       {
         doctokenizerYYsetStateHtmlOnly();
         retval = doctokenizerYYlex();
-        m_children.append(new DocVerbatim(this,g_context,g_token->verb,DocVerbatim::HtmlOnly,g_isExample,g_exampleName,g_token->name=="block"));
-        if (retval==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"htmlonly section ended without end marker");
+        m_children.append(new DocVerbatim(this,g_ctx->context,g_token->verb,DocVerbatim::HtmlOnly,g_ctx->isExample,g_ctx->exampleName,g_token->name=="block"));
+        if (retval==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"htmlonly section ended without end marker");
         doctokenizerYYsetStatePara();
       }
       break;
@@ -5499,8 +5673,8 @@ int DocPara::handleCommand(const QCString &cmdName)
       {
         doctokenizerYYsetStateManOnly();
         retval = doctokenizerYYlex();
-        m_children.append(new DocVerbatim(this,g_context,g_token->verb,DocVerbatim::ManOnly,g_isExample,g_exampleName));
-        if (retval==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"manonly section ended without end marker");
+        m_children.append(new DocVerbatim(this,g_ctx->context,g_token->verb,DocVerbatim::ManOnly,g_ctx->isExample,g_ctx->exampleName));
+        if (retval==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"manonly section ended without end marker");
         doctokenizerYYsetStatePara();
       }
       break;
@@ -5508,8 +5682,8 @@ int DocPara::handleCommand(const QCString &cmdName)
       {
         doctokenizerYYsetStateRtfOnly();
         retval = doctokenizerYYlex();
-        m_children.append(new DocVerbatim(this,g_context,g_token->verb,DocVerbatim::RtfOnly,g_isExample,g_exampleName));
-        if (retval==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"rtfonly section ended without end marker");
+        m_children.append(new DocVerbatim(this,g_ctx->context,g_token->verb,DocVerbatim::RtfOnly,g_ctx->isExample,g_ctx->exampleName));
+        if (retval==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"rtfonly section ended without end marker");
         doctokenizerYYsetStatePara();
       }
       break;
@@ -5517,8 +5691,8 @@ int DocPara::handleCommand(const QCString &cmdName)
       {
         doctokenizerYYsetStateLatexOnly();
         retval = doctokenizerYYlex();
-        m_children.append(new DocVerbatim(this,g_context,g_token->verb,DocVerbatim::LatexOnly,g_isExample,g_exampleName));
-        if (retval==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"latexonly section ended without end marker");
+        m_children.append(new DocVerbatim(this,g_ctx->context,g_token->verb,DocVerbatim::LatexOnly,g_ctx->isExample,g_ctx->exampleName));
+        if (retval==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"latexonly section ended without end marker");
         doctokenizerYYsetStatePara();
       }
       break;
@@ -5526,8 +5700,8 @@ int DocPara::handleCommand(const QCString &cmdName)
       {
         doctokenizerYYsetStateXmlOnly();
         retval = doctokenizerYYlex();
-        m_children.append(new DocVerbatim(this,g_context,g_token->verb,DocVerbatim::XmlOnly,g_isExample,g_exampleName));
-        if (retval==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"xmlonly section ended without end marker");
+        m_children.append(new DocVerbatim(this,g_ctx->context,g_token->verb,DocVerbatim::XmlOnly,g_ctx->isExample,g_ctx->exampleName));
+        if (retval==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"xmlonly section ended without end marker");
         doctokenizerYYsetStatePara();
       }
       break;
@@ -5535,8 +5709,8 @@ int DocPara::handleCommand(const QCString &cmdName)
       {
         doctokenizerYYsetStateDbOnly();
         retval = doctokenizerYYlex();
-        m_children.append(new DocVerbatim(this,g_context,g_token->verb,DocVerbatim::DocbookOnly,g_isExample,g_exampleName));
-        if (retval==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"docbookonly section ended without end marker",doctokenizerYYlineno);
+        m_children.append(new DocVerbatim(this,g_ctx->context,g_token->verb,DocVerbatim::DocbookOnly,g_ctx->isExample,g_ctx->exampleName));
+        if (retval==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"docbookonly section ended without end marker",doctokenizerYYlineno);
         doctokenizerYYsetStatePara();
       }
       break;
@@ -5544,14 +5718,14 @@ int DocPara::handleCommand(const QCString &cmdName)
       {
         doctokenizerYYsetStateVerbatim();
         retval = doctokenizerYYlex();
-        m_children.append(new DocVerbatim(this,g_context,g_token->verb,DocVerbatim::Verbatim,g_isExample,g_exampleName));
-        if (retval==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"verbatim section ended without end marker");
+        m_children.append(new DocVerbatim(this,g_ctx->context,g_token->verb,DocVerbatim::Verbatim,g_ctx->isExample,g_ctx->exampleName));
+        if (retval==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"verbatim section ended without end marker");
         doctokenizerYYsetStatePara();
       }
       break;
     case CMD_DOT:
       {
-        DocVerbatim *dv = new DocVerbatim(this,g_context,g_token->verb,DocVerbatim::Dot,g_isExample,g_exampleName);
+        DocVerbatim *dv = new DocVerbatim(this,g_ctx->context,g_token->verb,DocVerbatim::Dot,g_ctx->isExample,g_ctx->exampleName);
         doctokenizerYYsetStatePara();
         QCString width,height;
         defaultHandleTitleAndSize(CMD_DOT,dv,dv->children(),width,height);
@@ -5561,13 +5735,13 @@ int DocPara::handleCommand(const QCString &cmdName)
         dv->setWidth(width);
         dv->setHeight(height);
         m_children.append(dv);
-        if (retval==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"dot section ended without end marker");
+        if (retval==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"dot section ended without end marker");
         doctokenizerYYsetStatePara();
       }
       break;
     case CMD_MSC:
       {
-        DocVerbatim *dv = new DocVerbatim(this,g_context,g_token->verb,DocVerbatim::Msc,g_isExample,g_exampleName);
+        DocVerbatim *dv = new DocVerbatim(this,g_ctx->context,g_token->verb,DocVerbatim::Msc,g_ctx->isExample,g_ctx->exampleName);
         doctokenizerYYsetStatePara();
         QCString width,height;
         defaultHandleTitleAndSize(CMD_MSC,dv,dv->children(),width,height);
@@ -5577,7 +5751,7 @@ int DocPara::handleCommand(const QCString &cmdName)
         dv->setWidth(width);
         dv->setHeight(height);
         m_children.append(dv);
-        if (retval==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"msc section ended without end marker");
+        if (retval==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"msc section ended without end marker");
         doctokenizerYYsetStatePara();
       }
       break;
@@ -5587,7 +5761,7 @@ int DocPara::handleCommand(const QCString &cmdName)
         doctokenizerYYsetStatePlantUMLOpt();
         retval = doctokenizerYYlex();
         QCString plantFile(g_token->sectionId);
-        DocVerbatim *dv = new DocVerbatim(this,g_context,g_token->verb,DocVerbatim::PlantUML,FALSE,plantFile);
+        DocVerbatim *dv = new DocVerbatim(this,g_ctx->context,g_token->verb,DocVerbatim::PlantUML,FALSE,plantFile);
         doctokenizerYYsetStatePara();
         QCString width,height;
         defaultHandleTitleAndSize(CMD_STARTUML,dv,dv->children(),width,height);
@@ -5598,14 +5772,14 @@ int DocPara::handleCommand(const QCString &cmdName)
         dv->setHeight(height);
         if (jarPath.isEmpty())
         {
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"ignoring \\startuml command because PLANTUML_JAR_PATH is not set");
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"ignoring \\startuml command because PLANTUML_JAR_PATH is not set");
           delete dv;
         }
         else
         {
           m_children.append(dv);
         }
-        if (retval==0) warn_doc_error(g_fileName,doctokenizerYYlineno,"startuml section ended without end marker");
+        if (retval==0) warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"startuml section ended without end marker");
         doctokenizerYYsetStatePara();
       }
       break;
@@ -5624,7 +5798,7 @@ int DocPara::handleCommand(const QCString &cmdName)
     case CMD_ENDDOT:
     case CMD_ENDMSC:
     case CMD_ENDUML:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected command %s",qPrint(g_token->name));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected command %s",qPrint(g_token->name));
       break; 
     case CMD_PARAM:
       retval = handleParamSection(cmdName,DocParamSect::Param,FALSE,g_token->paramDir);
@@ -5659,8 +5833,8 @@ int DocPara::handleCommand(const QCString &cmdName)
     case CMD_ADDINDEX:
       {
         DocIndexEntry *ie = new DocIndexEntry(this,
-                     g_scope!=Doxygen::globalScope?g_scope:0,
-                     g_memberDef);
+                     g_ctx->scope!=Doxygen::globalScope?g_ctx->scope:0,
+                     g_ctx->memberDef);
         m_children.append(ie);
         retval = ie->parse();
       }
@@ -5762,10 +5936,10 @@ int DocPara::handleCommand(const QCString &cmdName)
       }
       break;
     case CMD_SECREFITEM:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected command %s",qPrint(g_token->name));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected command %s",qPrint(g_token->name));
       break;
     case CMD_ENDSECREFLIST:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected command %s",qPrint(g_token->name));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected command %s",qPrint(g_token->name));
       break;
     case CMD_FORMULA:
       {
@@ -5777,7 +5951,7 @@ int DocPara::handleCommand(const QCString &cmdName)
     //  retval = handleLanguageSwitch();
     //  break;
     case CMD_INTERNALREF:
-      //warn_doc_error(g_fileName,doctokenizerYYlineno,"unexpected command %s",qPrint(g_token->name));
+      //warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"unexpected command %s",qPrint(g_token->name));
       {
         DocInternalRef *ref = handleInternalRef(this);
         if (ref)
@@ -5832,7 +6006,7 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
   if (g_token->emptyTag && !(tagId&XML_CmdMask) && 
       tagId!=HTML_UNKNOWN && tagId!=HTML_IMG && tagId!=HTML_BR)
   {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"HTML tags may not use the 'empty tag' XHTML syntax.");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"HTML tags may not use the 'empty tag' XHTML syntax.");
   }
   switch (tagId)
   {
@@ -5853,7 +6027,7 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
     case HTML_LI:
       if (!insideUL(this) && !insideOL(this))
       {
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"lonely <li> tag found");
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"lonely <li> tag found");
       }
       else
       {
@@ -5864,7 +6038,7 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
       handleStyleEnter(this,m_children,DocStyleChange::Bold,&g_token->attribs);
       break;
     case HTML_CODE:
-      if (/*getLanguageFromFileName(g_fileName)==SrcLangExt_CSharp ||*/ g_xmlComment) 
+      if (/*getLanguageFromFileName(g_ctx->fileName)==SrcLangExt_CSharp ||*/ g_ctx->xmlComment) 
         // for C# source or inside a <summary> or <remark> section we 
         // treat <code> as an XML tag (so similar to @code)
       {
@@ -5916,7 +6090,7 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
       retval = RetVal_DescTitle;
       break;
     case HTML_DD:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag <dd> found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag <dd> found");
       break;
     case HTML_TABLE:
       {
@@ -5935,7 +6109,7 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
       retval = RetVal_TableHCell;
       break;
     case HTML_CAPTION:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag <caption> found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag <caption> found");
       break;
     case HTML_BR:
       {
@@ -5986,7 +6160,7 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
     case XML_SUMMARY:
     case XML_REMARKS:
     case XML_EXAMPLE:
-      g_xmlComment=TRUE;
+      g_ctx->xmlComment=TRUE;
       // fall through
     case XML_VALUE:
     case XML_PARA:
@@ -6007,7 +6181,7 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
     case XML_PARAM:
     case XML_TYPEPARAM:
       {
-        g_xmlComment=TRUE;
+        g_ctx->xmlComment=TRUE;
         QCString paramName;
         if (findAttribute(tagHtmlAttribs,"name",&paramName))
         {
@@ -6015,7 +6189,7 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
           {
             if (Config_getBool(WARN_NO_PARAMDOC))
             {
-              warn_doc_error(g_fileName,doctokenizerYYlineno,"empty 'name' attribute for <param%s> tag.",tagId==XML_PARAM?"":"type");
+              warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"empty 'name' attribute for <param%s> tag.",tagId==XML_PARAM?"":"type");
             }
           }
           else
@@ -6027,7 +6201,7 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
         }
         else
         {
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Missing 'name' attribute from <param%s> tag.",tagId==XML_PARAM?"":"type");
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Missing 'name' attribute from <param%s> tag.",tagId==XML_PARAM?"":"type");
         }
       }
       break;
@@ -6038,20 +6212,20 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
         if (findAttribute(tagHtmlAttribs,"name",&paramName))
         {
           //printf("paramName=%s\n",paramName.data());
-          m_children.append(new DocStyleChange(this,g_nodeStack.count(),DocStyleChange::Italic,TRUE));
+          m_children.append(new DocStyleChange(this,g_ctx->nodeStack.count(),DocStyleChange::Italic,TRUE));
           m_children.append(new DocWord(this,paramName)); 
-          m_children.append(new DocStyleChange(this,g_nodeStack.count(),DocStyleChange::Italic,FALSE));
+          m_children.append(new DocStyleChange(this,g_ctx->nodeStack.count(),DocStyleChange::Italic,FALSE));
           if (retval!=TK_WORD) m_children.append(new DocWhiteSpace(this," "));
         }
         else
         {
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Missing 'name' attribute from <param%sref> tag.",tagId==XML_PARAMREF?"":"type");
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Missing 'name' attribute from <param%sref> tag.",tagId==XML_PARAMREF?"":"type");
         }
       }
       break;
     case XML_EXCEPTION:
       {
-        g_xmlComment=TRUE;
+        g_ctx->xmlComment=TRUE;
         QCString exceptName;
         if (findAttribute(tagHtmlAttribs,"cref",&exceptName))
         {
@@ -6060,7 +6234,7 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
         }
         else
         {
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Missing 'cref' attribute from <exception> tag.");
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Missing 'cref' attribute from <exception> tag.");
         }
       }
       break;
@@ -6076,16 +6250,16 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
       }
       else
       {
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"lonely <item> tag found");
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"lonely <item> tag found");
       }
       break;
     case XML_RETURNS:
-      g_xmlComment=TRUE;
+      g_ctx->xmlComment=TRUE;
       retval = handleSimpleSection(DocSimpleSect::Return,TRUE);
-      g_hasReturnCommand=TRUE;
+      g_ctx->hasReturnCommand=TRUE;
       break;
     case XML_TERM:
-      //m_children.append(new DocStyleChange(this,g_nodeStack.count(),DocStyleChange::Bold,TRUE));
+      //m_children.append(new DocStyleChange(this,g_ctx->nodeStack.count(),DocStyleChange::Bold,TRUE));
       if (insideTable(this))
       {
         retval=RetVal_TableCell;
@@ -6104,11 +6278,11 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
           unescapeCRef(cref);
           if (g_token->emptyTag) // <see cref="..."/> style
           {
-            bool inSeeBlock = g_inSeeBlock;
+            bool inSeeBlock = g_ctx->inSeeBlock;
             g_token->name = cref;
-            g_inSeeBlock = TRUE;
+            g_ctx->inSeeBlock = TRUE;
             handleLinkedWord(this,m_children,TRUE);
-            g_inSeeBlock = inSeeBlock;
+            g_ctx->inSeeBlock = inSeeBlock;
           }
           else // <see cref="...">...</see> style
           {
@@ -6138,13 +6312,13 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
         }
         else
         {
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Missing 'cref' or 'langword' attribute from <see> tag.");
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Missing 'cref' or 'langword' attribute from <see> tag.");
         }
       }
       break;
     case XML_SEEALSO:
       {
-        g_xmlComment=TRUE;
+        g_ctx->xmlComment=TRUE;
         QCString cref;
         if (findAttribute(tagHtmlAttribs,"cref",&cref))
         {
@@ -6172,7 +6346,7 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
         }
         else
         {
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"Missing 'cref' attribute from <seealso> tag.");
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Missing 'cref' attribute from <seealso> tag.");
         }
       }
       break;
@@ -6203,10 +6377,10 @@ int DocPara::handleHtmlStartTag(const QCString &tagName,const HtmlAttribList &ta
     case XML_INCLUDE:
     case XML_PERMISSION:
       // These tags are defined in .Net but are currently unsupported
-      g_xmlComment=TRUE;
+      g_ctx->xmlComment=TRUE;
       break;
     case HTML_UNKNOWN:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported xml/html tag <%s> found", qPrint(tagName));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported xml/html tag <%s> found", qPrint(tagName));
       m_children.append(new DocWord(this, "<"+tagName+tagHtmlAttribs.toString()+">"));
       break;
   case XML_INHERITDOC:
@@ -6230,7 +6404,7 @@ int DocPara::handleHtmlEndTag(const QCString &tagName)
     case HTML_UL: 
       if (!insideUL(this))
       {
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"found </ul> tag without matching <ul>");
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found </ul> tag without matching <ul>");
       }
       else
       {
@@ -6240,7 +6414,7 @@ int DocPara::handleHtmlEndTag(const QCString &tagName)
     case HTML_OL: 
       if (!insideOL(this))
       {
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"found </ol> tag without matching <ol>");
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found </ol> tag without matching <ol>");
       }
       else
       {
@@ -6250,7 +6424,7 @@ int DocPara::handleHtmlEndTag(const QCString &tagName)
     case HTML_LI:
       if (!insideLI(this))
       {
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"found </li> tag without matching <li>");
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found </li> tag without matching <li>");
       }
       else
       {
@@ -6263,7 +6437,7 @@ int DocPara::handleHtmlEndTag(const QCString &tagName)
     //case HTML_PRE:
     //  if (!insidePRE(this))
     //  {
-    //    warn_doc_error(g_fileName,doctokenizerYYlineno,"found </pre> tag without matching <pre>");
+    //    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found </pre> tag without matching <pre>");
     //  }
     //  else
     //  {
@@ -6327,42 +6501,42 @@ int DocPara::handleHtmlEndTag(const QCString &tagName)
       // ignore </th> tag
       break;
     case HTML_CAPTION:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag </caption> found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag </caption> found");
       break;
     case HTML_BR:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Illegal </br> tag found\n");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Illegal </br> tag found\n");
       break;
     case HTML_H1:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag </h1> found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag </h1> found");
       break;
     case HTML_H2:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag </h2> found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag </h2> found");
       break;
     case HTML_H3:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag </h3> found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag </h3> found");
       break;
     case HTML_H4:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag </h4> found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag </h4> found");
       break;
     case HTML_H5:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag </h5> found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag </h5> found");
       break;
     case HTML_H6:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag </h6> found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag </h6> found");
       break;
     case HTML_IMG:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag </img> found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag </img> found");
       break;
     case HTML_HR:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag </hr> found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag </hr> found");
       break;
     case HTML_A:
-      //warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected tag </a> found");
+      //warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected tag </a> found");
       // ignore </a> tag (can be part of <a name=...></a>
       break;
 
     case XML_TERM:
-      //m_children.append(new DocStyleChange(this,g_nodeStack.count(),DocStyleChange::Bold,FALSE));
+      //m_children.append(new DocStyleChange(this,g_ctx->nodeStack.count(),DocStyleChange::Bold,FALSE));
       break;
     case XML_SUMMARY:
     case XML_REMARKS:
@@ -6392,12 +6566,12 @@ int DocPara::handleHtmlEndTag(const QCString &tagName)
       // These tags are defined in .Net but are currently unsupported
       break;
     case HTML_UNKNOWN:
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported xml/html tag </%s> found", qPrint(tagName));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported xml/html tag </%s> found", qPrint(tagName));
       m_children.append(new DocWord(this,"</"+tagName+">"));
       break;
     default:
       // we should not get here!
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected end tag %s\n",qPrint(tagName));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected end tag %s\n",qPrint(tagName));
       ASSERT(0);
       break;
   }
@@ -6407,7 +6581,7 @@ int DocPara::handleHtmlEndTag(const QCString &tagName)
 int DocPara::parse()
 {
   DBG(("DocPara::parse() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   // handle style commands "inherited" from the previous paragraph
   handleInitialStyleCommands(this,m_children);
   int tok;
@@ -6550,13 +6724,13 @@ reparsetoken:
           }
           else
           {
-            warn_doc_error(g_fileName,doctokenizerYYlineno,"End of list marker found "
+            warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"End of list marker found "
                 "has invalid indent level");
           }
         }
         else
         {
-          warn_doc_error(g_fileName,doctokenizerYYlineno,"End of list marker found without any preceding "
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"End of list marker found without any preceding "
               "list items");
         }
         break;
@@ -6667,7 +6841,7 @@ reparsetoken:
           }
           else
           {
-            warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+            warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
                 qPrint(g_token->name));
           }
           break;
@@ -6702,7 +6876,7 @@ reparsetoken:
         }
         break;
       default:
-        warn_doc_error(g_fileName,doctokenizerYYlineno,
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,
             "Found unexpected token (id=%x)\n",tok);
         break;
     }
@@ -6710,7 +6884,7 @@ reparsetoken:
   retval=0;
 endparagraph:
   handlePendingStyleCommands(this,m_children);
-  DocNode *n = g_nodeStack.pop();
+  DocNode *n = g_ctx->nodeStack.pop();
   ASSERT(n==this);
   DBG(("DocPara::parse() end retval=%x\n",retval));
   INTERNAL_ASSERT(retval==0 || retval==TK_NEWPARA || retval==TK_LISTITEM || 
@@ -6726,7 +6900,7 @@ int DocSection::parse()
 {
   DBG(("DocSection::parse() start %s level=%d\n",qPrint(g_token->sectionId),m_level));
   int retval=RetVal_OK;
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
 
   SectionInfo *sec;
   if (!m_id.isEmpty())
@@ -6738,9 +6912,9 @@ int DocSection::parse()
       m_anchor = sec->label;
       m_title  = sec->title;
       if (m_title.isEmpty()) m_title = sec->label;
-      if (g_sectionDict && g_sectionDict->find(m_id)==0)
+      if (g_ctx->sectionDict && g_ctx->sectionDict->find(m_id)==0)
       {
-        g_sectionDict->append(m_id,sec);
+        g_ctx->sectionDict->append(m_id,sec);
       }
     }
   }
@@ -6764,7 +6938,7 @@ int DocSection::parse()
     }
     if (retval==TK_LISTITEM)
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Invalid list item found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Invalid list item found");
     }
     if (retval==RetVal_Internal)
     {
@@ -6829,7 +7003,7 @@ int DocSection::parse()
           )
   {
     int level = (retval==RetVal_Subsubsection) ? 3 : 4;
-    warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected %s "
+    warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected %s "
             "command found inside %s!",
             sectionLevelToName[level],sectionLevelToName[m_level]);
     retval=0; // stop parsing
@@ -6848,7 +7022,7 @@ int DocSection::parse()
                  );
 
   DBG(("DocSection::parse() end: retval=%x\n",retval));
-  DocNode *n = g_nodeStack.pop();
+  DocNode *n = g_ctx->nodeStack.pop();
   ASSERT(n==this);
   return retval;
 }
@@ -6858,7 +7032,7 @@ int DocSection::parse()
 void DocText::parse()
 {
   DBG(("DocText::parse() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   doctokenizerYYsetStateText();
   
   int tok;
@@ -6881,7 +7055,7 @@ void DocText::parse()
           }
           else
           {
-            warn_doc_error(g_fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
+            warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unsupported symbol %s found",
                 qPrint(g_token->name));
           }
         }
@@ -6938,13 +7112,13 @@ void DocText::parse()
             m_children.append(new DocSymbol(this,DocSymbol::Sym_Minus));
             break;
           default:
-            warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected command `%s' found",
+            warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected command `%s' found",
                       qPrint(g_token->name));
             break;
         }
         break;
       default:
-        warn_doc_error(g_fileName,doctokenizerYYlineno,"Unexpected token %s",
+        warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Unexpected token %s",
             tokToString(tok));
         break;
     }
@@ -6952,7 +7126,7 @@ void DocText::parse()
 
   handleUnclosedStyleCommands();
 
-  DocNode *n = g_nodeStack.pop();
+  DocNode *n = g_ctx->nodeStack.pop();
   ASSERT(n==this);
   DBG(("DocText::parse() end\n"));
 }
@@ -6963,7 +7137,7 @@ void DocText::parse()
 void DocRoot::parse()
 {
   DBG(("DocRoot::parse() start\n"));
-  g_nodeStack.push(this);
+  g_ctx->nodeStack.push(this);
   doctokenizerYYsetStatePara();
   int retval=0;
 
@@ -6986,19 +7160,19 @@ void DocRoot::parse()
     }
     if (retval==TK_LISTITEM)
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Invalid list item found");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Invalid list item found");
     }
     else if (retval==RetVal_Subsection)
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"found subsection command outside of section context!");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found subsection command outside of section context!");
     }
     else if (retval==RetVal_Subsubsection)
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"found subsubsection command outside of subsection context!");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found subsubsection command outside of subsection context!");
     }
     else if (retval==RetVal_Paragraph)
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"found paragraph command outside of subsubsection context!");
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"found paragraph command outside of subsubsection context!");
     }
     if (retval==RetVal_Internal)
     {
@@ -7023,14 +7197,14 @@ void DocRoot::parse()
     }
     else
     {
-      warn_doc_error(g_fileName,doctokenizerYYlineno,"Invalid section id `%s'; ignoring section",qPrint(g_token->sectionId));
+      warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,"Invalid section id `%s'; ignoring section",qPrint(g_token->sectionId));
       retval = 0;
     }
   }
 
   handleUnclosedStyleCommands();
 
-  DocNode *n = g_nodeStack.pop();
+  DocNode *n = g_ctx->nodeStack.pop();
   ASSERT(n==this);
   DBG(("DocRoot::parse() end\n"));
 }
@@ -7174,9 +7348,9 @@ static QCString processCopyDoc(const char *data,uint &len)
         if (findDocsForMemberOrCompound(id,&doc,&brief,&def))
         {
           //printf("found it def=%p brief='%s' doc='%s' isBrief=%d\n",def,brief.data(),doc.data(),isBrief);
-          if (g_copyStack.findRef(def)==-1) // definition not parsed earlier
+          if (g_ctx->copyStack.findRef(def)==-1) // definition not parsed earlier
           {
-            g_copyStack.append(def);
+            g_ctx->copyStack.append(def);
             if (isBrief)
             {
               uint l=brief.length();
@@ -7187,18 +7361,18 @@ static QCString processCopyDoc(const char *data,uint &len)
               uint l=doc.length();
               buf.addStr(processCopyDoc(doc,l));
             }
-            g_copyStack.remove(def);
+            g_ctx->copyStack.remove(def);
           }
           else
           {
-            warn_doc_error(g_fileName,doctokenizerYYlineno,
+            warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,
 	         "Found recursive @copy%s or @copydoc relation for argument '%s'.\n",
                  isBrief?"brief":"details",id.data());
           }
         }
         else
         {
-          warn_doc_error(g_fileName,doctokenizerYYlineno,
+          warn_doc_error(g_ctx->fileName,doctokenizerYYlineno,
                "@copy%s or @copydoc target '%s' not found", isBrief?"brief":"details",
                id.data());
         }
@@ -7379,51 +7553,51 @@ DocRoot *validatingParseDoc(const char *fileName,int startLine,
       ) 
      ) 
   {
-    g_context = ctx->name();
+    g_ctx->context = ctx->name();
   }
   else if (ctx && ctx->definitionType()==Definition::TypePage)
   {
     Definition *scope = ((PageDef*)ctx)->getPageScope();
-    if (scope && scope!=Doxygen::globalScope) g_context = scope->name();
+    if (scope && scope!=Doxygen::globalScope) g_ctx->context = scope->name();
   }
   else if (ctx && ctx->definitionType()==Definition::TypeGroup)
   {
     Definition *scope = ((GroupDef*)ctx)->getGroupScope();
-    if (scope && scope!=Doxygen::globalScope) g_context = scope->name();
+    if (scope && scope!=Doxygen::globalScope) g_ctx->context = scope->name();
   }
   else
   {
-    g_context = "";
+    g_ctx->context = "";
   }
-  g_scope = ctx;
+  g_ctx->scope = ctx;
 
   if (indexWords && Doxygen::searchIndex)
   {
     if (md)
     {
-      g_searchUrl=md->getOutputFileBase();
+      g_ctx->searchUrl=md->getOutputFileBase();
       Doxygen::searchIndex->setCurrentDoc(md,md->anchor(),FALSE);
     }
     else if (ctx)
     {
-      g_searchUrl=ctx->getOutputFileBase();
+      g_ctx->searchUrl=ctx->getOutputFileBase();
       Doxygen::searchIndex->setCurrentDoc(ctx,ctx->anchor(),FALSE);
     }
   }
 #if 0
   if (indexWords && md && Doxygen::searchIndex)
   {
-    g_searchUrl=md->getOutputFileBase();
+    g_ctx->searchUrl=md->getOutputFileBase();
     Doxygen::searchIndex->setCurrentDoc(
         (md->getLanguage()==SrcLangExt_Fortran ? 
          theTranslator->trSubprogram(TRUE,TRUE):
          theTranslator->trMember(TRUE,TRUE))+" "+md->qualifiedName(),
-        g_searchUrl,
+        g_ctx->searchUrl,
         md->anchor());
   }
   else if (indexWords && ctx && Doxygen::searchIndex)
   {
-    g_searchUrl=ctx->getOutputFileBase();
+    g_ctx->searchUrl=ctx->getOutputFileBase();
     QCString name = ctx->qualifiedName();
 
     SrcLangExt lang = ctx->getLanguage();
@@ -7486,38 +7660,38 @@ DocRoot *validatingParseDoc(const char *fileName,int startLine,
       default:
         break;
     }
-    Doxygen::searchIndex->setCurrentDoc(name,g_searchUrl);
+    Doxygen::searchIndex->setCurrentDoc(name,g_ctx->searchUrl);
   }
 #endif
   else
   {
-    g_searchUrl="";
+    g_ctx->searchUrl="";
   }
 
-  g_fileName = fileName;
-  g_relPath = (!linkFromIndex && ctx) ? 
+  g_ctx->fileName = fileName;
+  g_ctx->relPath = (!linkFromIndex && ctx) ? 
                QCString(relativePathToRoot(ctx->getOutputFileBase())) : 
                QCString("");
-  //printf("ctx->name=%s relPath=%s\n",ctx->name().data(),g_relPath.data());
-  g_memberDef = md;
-  g_nodeStack.clear();
-  g_styleStack.clear();
-  g_initialStyleStack.clear();
-  g_inSeeBlock = FALSE;
-  g_xmlComment = FALSE;
-  g_insideHtmlLink = FALSE;
-  g_includeFileText = "";
-  g_includeFileOffset = 0;
-  g_includeFileLength = 0;
-  g_isExample = isExample;
-  g_exampleName = exampleName;
-  g_hasParamCommand = FALSE;
-  g_hasReturnCommand = FALSE;
-  g_paramsFound.setAutoDelete(FALSE);
-  g_paramsFound.clear();
-  g_sectionDict = 0; //sections;
+  //printf("ctx->name=%s relPath=%s\n",ctx->name().data(),g_ctx->relPath.data());
+  g_ctx->memberDef = md;
+  g_ctx->nodeStack.clear();
+  g_ctx->styleStack.clear();
+  g_ctx->initialStyleStack.clear();
+  g_ctx->inSeeBlock = FALSE;
+  g_ctx->xmlComment = FALSE;
+  g_ctx->insideHtmlLink = FALSE;
+  g_ctx->includeFileText = "";
+  g_ctx->includeFileOffset = 0;
+  g_ctx->includeFileLength = 0;
+  g_ctx->isExample = isExample;
+  g_ctx->exampleName = exampleName;
+  g_ctx->hasParamCommand = FALSE;
+  g_ctx->hasReturnCommand = FALSE;
+  g_ctx->paramsFound.setAutoDelete(FALSE);
+  g_ctx->paramsFound.clear();
+  g_ctx->sectionDict = 0; //sections;
   
-  //printf("Starting comment block at %s:%d\n",g_fileName.data(),startLine);
+  //printf("Starting comment block at %s:%d\n",g_ctx->fileName.data(),startLine);
   doctokenizerYYlineno=startLine;
   uint inpLen=qstrlen(input);
   QCString inpStr = processCopyDoc(input,inpLen);
@@ -7526,7 +7700,7 @@ DocRoot *validatingParseDoc(const char *fileName,int startLine,
     inpStr+='\n';
   }
   //printf("processCopyDoc(in='%s' out='%s')\n",input,inpStr.data());
-  doctokenizerYYinit(inpStr,g_fileName);
+  doctokenizerYYinit(inpStr,g_ctx->fileName);
 
   // build abstract syntax tree
   DocRoot *root = new DocRoot(md!=0,singleLine);
@@ -7558,6 +7732,201 @@ DocRoot *validatingParseDoc(const char *fileName,int startLine,
   return root;
 }
 
+//---------------------------------------------------------------------------
+
+/** @brief A parsed documentation block kept in the DocRootCache. */
+struct DocCacheEntry
+{
+  DocCacheEntry(const QCString &k,DocRoot *r)
+    : key(k), root(r), refCount(0), cached(TRUE), prev(0), next(0) {}
+  QCString key;
+  DocRoot *root;
+  int refCount;          // number of callers still using root
+  bool cached;           // FALSE once the entry is evicted from the cache
+  DocCacheEntry *prev;   // LRU list, most recently used first
+  DocCacheEntry *next;
+};
+
+/** @brief Least recently used cache of parsed documentation blocks.
+ *
+ *  Trees that are evicted while still in use are deleted when the last
+ *  user releases them.
+ */
+class DocRootCache
+{
+  public:
+    DocRootCache() : m_dict(1009), m_roots(1009), m_head(0), m_tail(0),
+                     m_count(0), m_hits(0), m_misses(0) {}
+   ~DocRootCache() { clear(); }
+
+    DocRoot *find(const QCString &key)
+    {
+      DocCacheEntry *e = m_dict.find(key);
+      if (e==0) { m_misses++; return 0; }
+      m_hits++;
+      unlink(e);
+      pushFront(e);
+      e->refCount++;
+      return e->root;
+    }
+    void insert(const QCString &key,DocRoot *root,int maxCount)
+    {
+      DocCacheEntry *e = new DocCacheEntry(key,root);
+      e->refCount++;
+      m_dict.insert(key,e);
+      m_roots.insert(root,e);
+      pushFront(e);
+      m_count++;
+      // make room by evicting the least recently used entries
+      DocCacheEntry *victim = m_tail;
+      while (m_count>maxCount && victim)
+      {
+        DocCacheEntry *prev = victim->prev;
+        evict(victim);
+        victim = prev;
+      }
+      resizeIfNeeded();
+    }
+    /*! Returns FALSE if \a root is not managed by this cache */
+    bool release(DocNode *root)
+    {
+      DocCacheEntry *e = m_roots.find(root);
+      if (e==0) return FALSE;
+      e->refCount--;
+      if (!e->cached && e->refCount==0)
+      {
+        m_roots.remove(root);
+        delete e->root;
+        delete e;
+      }
+      return TRUE;
+    }
+    void clear()
+    {
+      DocCacheEntry *e = m_head;
+      while (e)
+      {
+        DocCacheEntry *next = e->next;
+        evict(e);
+        e = next;
+      }
+    }
+    int count() const  { return m_count; }
+    int hits() const   { return m_hits; }
+    int misses() const { return m_misses; }
+
+  private:
+    void pushFront(DocCacheEntry *e)
+    {
+      e->prev = 0;
+      e->next = m_head;
+      if (m_head) m_head->prev = e; else m_tail = e;
+      m_head = e;
+    }
+    void unlink(DocCacheEntry *e)
+    {
+      if (e->prev) e->prev->next = e->next; else m_head = e->next;
+      if (e->next) e->next->prev = e->prev; else m_tail = e->prev;
+      e->prev = e->next = 0;
+    }
+    void evict(DocCacheEntry *e)
+    {
+      unlink(e);
+      m_dict.remove(e->key);
+      m_count--;
+      e->cached = FALSE;
+      if (e->refCount==0) // not in use, so it can be deleted right away
+      {
+        m_roots.remove(e->root);
+        delete e->root;
+        delete e;
+      }
+    }
+    void resizeIfNeeded()
+    {
+      if (m_count>(int)m_dict.size()*2)
+      {
+        m_dict.resize(m_dict.size()*4+1);
+        m_roots.resize(m_roots.size()*4+1);
+      }
+    }
+
+    QDict<DocCacheEntry>    m_dict;
+    QPtrDict<DocCacheEntry> m_roots;
+    DocCacheEntry *m_head;
+    DocCacheEntry *m_tail;
+    int m_count;
+    int m_hits;
+    int m_misses;
+};
+
+static DocRootCache *g_docRootCache;
+
+DocRoot *validatingParseDocCached(const char *fileName,int startLine,
+                                  Definition *ctx,MemberDef *md,
+                                  const char *input,bool indexWords,
+                                  bool isExample, const char *exampleName,
+                                  bool singleLine, bool linkFromIndex)
+{
+  static int cacheSize = Config_getInt(DOC_CACHE_SIZE);
+  // words are added to the search index while parsing, so a cached tree
+  // cannot be used in that case.
+  if (cacheSize<=0 || (indexWords && Doxygen::searchIndex))
+  {
+    return validatingParseDoc(fileName,startLine,ctx,md,input,indexWords,
+                              isExample,exampleName,singleLine,linkFromIndex);
+  }
+  if (g_docRootCache==0) g_docRootCache = new DocRootCache;
+
+  QCString key;
+  key.sprintf("%p:%p:%d:%d:%d:%d:%d:",ctx,md,startLine,isExample,singleLine,
+                                      linkFromIndex,Doxygen::subpageNestingLevel);
+  key+=fileName;
+  key+=':';
+  key+=exampleName;
+  key+='\n';
+  key+=input;
+
+  DocRoot *root = g_docRootCache->find(key);
+  if (root==0)
+  {
+    root = validatingParseDoc(fileName,startLine,ctx,md,input,indexWords,
+                              isExample,exampleName,singleLine,linkFromIndex);
+    g_docRootCache->insert(key,root,cacheSize);
+  }
+  return root;
+}
+
+void releaseParsedDoc(DocNode *root)
+{
+  if (root==0) return;
+  if (g_docRootCache==0 || !g_docRootCache->release(root))
+  {
+    // not a cached tree
+    delete root;
+  }
+}
+
+void docParserClearCache()
+{
+  delete g_docRootCache;
+  g_docRootCache=0;
+}
+
+void docParserPrintCacheStats()
+{
+  if (g_docRootCache)
+  {
+    msg("documentation cache used %d/%d hits=%d misses=%d\n",
+        g_docRootCache->count(),
+        Config_getInt(DOC_CACHE_SIZE),
+        g_docRootCache->hits(),
+        g_docRootCache->misses());
+  }
+}
+
+//---------------------------------------------------------------------------
+
 DocText *validatingParseText(const char *input)
 {
   // store parser state so we can re-enter this function if needed
@@ -7566,33 +7935,33 @@ DocText *validatingParseText(const char *input)
   //printf("------------ input ---------\n%s\n"
   //       "------------ end input -----\n",input);
   //g_token = new TokenInfo;
-  g_context = "";
-  g_fileName = "<parseText>";
-  g_relPath = "";
-  g_memberDef = 0;
-  g_nodeStack.clear();
-  g_styleStack.clear();
-  g_initialStyleStack.clear();
-  g_inSeeBlock = FALSE;
-  g_xmlComment = FALSE;
-  g_insideHtmlLink = FALSE;
-  g_includeFileText = "";
-  g_includeFileOffset = 0;
-  g_includeFileLength = 0;
-  g_isExample = FALSE;
-  g_exampleName = "";
-  g_hasParamCommand = FALSE;
-  g_hasReturnCommand = FALSE;
-  g_paramsFound.setAutoDelete(FALSE);
-  g_paramsFound.clear();
-  g_searchUrl="";
+  g_ctx->context = "";
+  g_ctx->fileName = "<parseText>";
+  g_ctx->relPath = "";
+  g_ctx->memberDef = 0;
+  g_ctx->nodeStack.clear();
+  g_ctx->styleStack.clear();
+  g_ctx->initialStyleStack.clear();
+  g_ctx->inSeeBlock = FALSE;
+  g_ctx->xmlComment = FALSE;
+  g_ctx->insideHtmlLink = FALSE;
+  g_ctx->includeFileText = "";
+  g_ctx->includeFileOffset = 0;
+  g_ctx->includeFileLength = 0;
+  g_ctx->isExample = FALSE;
+  g_ctx->exampleName = "";
+  g_ctx->hasParamCommand = FALSE;
+  g_ctx->hasReturnCommand = FALSE;
+  g_ctx->paramsFound.setAutoDelete(FALSE);
+  g_ctx->paramsFound.clear();
+  g_ctx->searchUrl="";
 
   DocText *txt = new DocText;
 
   if (input)
   {
     doctokenizerYYlineno=1;
-    doctokenizerYYinit(input,g_fileName);
+    doctokenizerYYinit(input,g_ctx->fileName);
 
     // build abstract syntax tree
     txt->parse();
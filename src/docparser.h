@@ -70,6 +70,28 @@ DocRoot *validatingParseDoc(const char *fileName,int startLine,
                             bool isExample,const char *exampleName=0,
                             bool singleLine=FALSE,bool linkFromIndex=FALSE);
 
+/*! Same as validatingParseDoc(), but the resulting tree is kept in a cache
+ *  of DOC_CACHE_SIZE entries, so a later call with the same arguments returns
+ *  the same tree instead of parsing the input again. A cached tree is shared
+ *  between all callers and must not be modified while it is visited.
+ *  @returns Root node of the abstract syntax tree. The tree must be released
+ *           with releaseParsedDoc() instead of being deleted.
+ */
+DocRoot *validatingParseDocCached(const char *fileName,int startLine,
+                                  Definition *context, MemberDef *md,
+                                  const char *input,bool indexWords,
+                                  bool isExample,const char *exampleName=0,
+                                  bool singleLine=FALSE,bool linkFromIndex=FALSE);
+
+/*! Releases a tree returned by validatingParseDocCached(). */
+void releaseParsedDoc(DocNode *root);
+
+/*! Removes all trees from the cache of parsed documentation blocks. */
+void docParserClearCache();
+
+/*! Prints the usage statistics of the cache of parsed documentation blocks. */
+void docParserPrintCacheStats();
+
 /*! Main entry point for parsing simple text fragments. These 
  *  fragments are limited to words, whitespace and symbols.
  */
@@ -148,6 +170,14 @@ class DocNode
     /*! Destroys a node. */
     virtual ~DocNode() {}
 
+    /*! Allocates memory for a node. Small nodes are taken from a pool
+     *  instead of being allocated one by one.
+     */
+    static void *operator new(size_t size);
+
+    /*! Returns the memory of a node to the pool it came from. */
+    static void operator delete(void *ptr,size_t size);
+
     /*! Returns the kind of node. Provides runtime type information */
     virtual Kind kind() const = 0;
 
@@ -540,7 +570,8 @@ class DocInclude : public DocNode
                const QCString blockId) : 
       m_file(file), m_context(context), m_type(t),
       m_isExample(isExample), m_exampleFile(exampleFile),
-      m_blockId(blockId) { m_parent = parent; }
+      m_blockId(blockId), m_blockStart(0), m_blockLength(0),
+      m_blockLine(1) { m_parent = parent; }
     Kind kind() const            { return Kind_Include; }
     QCString file() const        { return m_file; }
     QCString extension() const   { int i=m_file.findRev('.'); 
@@ -553,6 +584,8 @@ class DocInclude : public DocNode
     QCString text() const        { return m_text; }
     QCString context() const     { return m_context; }
     QCString blockId() const     { return m_blockId; }
+    QCString blockText() const   { return m_text.mid(m_blockStart,m_blockLength); }
+    int blockLine() const        { return m_blockLine; }
     bool isExample() const       { return m_isExample; }
     QCString exampleFile() const { return m_exampleFile; }
     void accept(DocVisitor *v)   { v->visit(this); }
@@ -566,6 +599,9 @@ class DocInclude : public DocNode
     bool      m_isExample;
     QCString  m_exampleFile;
     QCString  m_blockId;
+    int       m_blockStart;  // offset of the snippet in m_text
+    int       m_blockLength; // length of the snippet
+    int       m_blockLine;   // line number of the first line of the snippet
 };
 
 /** Node representing a include/dontinclude operator block */
@@ -100,6 +100,7 @@
 #include "settings.h"
 #include "context.h"
 #include "fileparser.h"
+#include "outputmanifest.h"
 #include "verilogscanner.h"
 
 // provided by the generated file resources.cpp
@@ -10101,6 +10102,7 @@ void initDoxygen()
 
 void cleanUpDoxygen()
 {
+  docParserClearCache();
   delete Doxygen::sectionDict;
   delete Doxygen::formulaNameDict;
   delete Doxygen::formulaDict;
@@ -10715,6 +10717,12 @@ static void writeTagFile()
   */
 
   tagFile << "</tagfile>" << endl;
+  tag.close();
+
+  if (Config_getBool(GENERATE_TAGFILE_INDEX))
+  {
+    writeTagFileIndex(QFileInfo(generateTagFile).absFilePath().utf8());
+  }
 }
 
 static void exitDoxygen()
@@ -11254,13 +11262,16 @@ void parseInput()
   flushCachedTemplateRelations();
   g_s.end();
 
-  g_s.begin("Computing class relations...\n");
-  computeTemplateClassRelations();
-  flushUnresolvedRelations();
   if (Config_getBool(OPTIMIZE_OUTPUT_VHDL))
   {
+    g_s.begin("Computing VHDL component relations...\n");
     VhdlDocGen::computeVhdlComponentRelations();
+    g_s.end();
   }
+
+  g_s.begin("Computing class relations...\n");
+  computeTemplateClassRelations();
+  flushUnresolvedRelations();
   computeClassRelations();
   g_classEntries.clear();
   g_s.end();
@@ -11485,6 +11496,8 @@ void generateOutput()
    *                        Generate documentation                          *
    **************************************************************************/
 
+  OutputManifest::init();
+
   if (generateHtml)  writeDoxFont(Config_getString(HTML_OUTPUT));
   if (generateLatex) writeDoxFont(Config_getString(LATEX_OUTPUT));
   if (generateRtf)   writeDoxFont(Config_getString(RTF_OUTPUT));
@@ -11679,6 +11692,8 @@ void generateOutput()
     g_s.end();
   }
 
+  OutputManifest::finish();
+
   if (Config_getBool(HAVE_DOT))
   {
     g_s.begin("Running dot...\n");
@@ -11753,6 +11768,7 @@ void generateOutput()
   {
     msg("Note: based on cache misses the ideal setting for LOOKUP_CACHE_SIZE is %d at the cost of higher memory usage.\n",cacheParam);
   }
+  docParserPrintCacheStats();
 
   if (Debug::isFlagSet(Debug::Time))
   {
@@ -33,6 +33,91 @@
 
 int Entry::num=0;
 
+//------------------------------------------------------------------
+
+#define ENTRY_CHUNK_SIZE 256
+
+/** Allocator for Entry objects.
+ *
+ *  Memory is obtained in chunks of ENTRY_CHUNK_SIZE entries. Entries that
+ *  are deleted are put on a free list and reused by the next allocation, so
+ *  after the entry tree of a file has been stored by EntryNav::saveEntry()
+ *  the tree for the next file is built in the same, contiguous memory.
+ *  The chunks are only returned when the pool itself is destroyed.
+ */
+class EntryPool
+{
+  public:
+    EntryPool() : m_chunks(0), m_freeList(0) {}
+   ~EntryPool()
+    {
+      while (m_chunks)
+      {
+        Chunk *next = m_chunks->next;
+        ::operator delete(m_chunks);
+        m_chunks = next;
+      }
+    }
+    void *alloc()
+    {
+      if (m_freeList==0) newChunk();
+      Slot *s = m_freeList;
+      m_freeList = s->next;
+      return s;
+    }
+    void release(void *p)
+    {
+      Slot *s = (Slot*)p;
+      s->next = m_freeList;
+      m_freeList = s;
+    }
+  private:
+    union Slot
+    {
+      Slot   *next;
+      double  align;
+      char    data[sizeof(Entry)];
+    };
+    struct Chunk
+    {
+      Chunk *next;
+      Slot   slots[ENTRY_CHUNK_SIZE];
+    };
+    void newChunk()
+    {
+      Chunk *c = (Chunk*)::operator new(sizeof(Chunk));
+      c->next  = m_chunks;
+      m_chunks = c;
+      // link the slots in order, so consecutive allocations are adjacent
+      for (int i=ENTRY_CHUNK_SIZE-1;i>=0;i--)
+      {
+        c->slots[i].next = m_freeList;
+        m_freeList = &c->slots[i];
+      }
+    }
+    Chunk *m_chunks;
+    Slot  *m_freeList;
+};
+
+// intentionally never deleted: entries may still be released during exit
+static EntryPool *g_entryPool = 0;
+
+void *Entry::operator new(size_t size)
+{
+  if (size!=sizeof(Entry)) return ::operator new(size);
+  if (g_entryPool==0) g_entryPool = new EntryPool;
+  return g_entryPool->alloc();
+}
+
+void Entry::operator delete(void *ptr,size_t size)
+{
+  if (ptr==0) return;
+  if (size!=sizeof(Entry)) { ::operator delete(ptr); return; }
+  g_entryPool->release(ptr);
+}
+
+//------------------------------------------------------------------
+
 Entry::Entry()
 {
   //printf("Entry::Entry(%p)\n",this);
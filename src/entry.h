@@ -192,6 +192,12 @@ class Entry
     Entry(const Entry &);
    ~Entry();
 
+    /*! Entries are carved out of larger memory chunks and recycled via a
+     *  free list, since the scanners create and destroy them in bulk.
+     */
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr,size_t size);
+
     /*! Returns the static size of the Entry (so excluding any dynamic memory) */
     int getSize();
 
@@ -380,7 +380,7 @@ void FileDef::writeBriefDescription(OutputList &ol)
 {
   if (hasBriefDescription())
   {
-    DocRoot *rootNode = validatingParseDoc(briefFile(),briefLine(),this,0,
+    DocRoot *rootNode = validatingParseDocCached(briefFile(),briefLine(),this,0,
                        briefDescription(),TRUE,FALSE,0,TRUE,FALSE);
 
     if (rootNode && !rootNode->isEmpty())
@@ -408,7 +408,7 @@ void FileDef::writeBriefDescription(OutputList &ol)
       ol.popGeneratorState();
       ol.endParagraph();
     }
-    delete rootNode;
+    releaseParsedDoc(rootNode);
   }
   ol.writeSynopsis();
 }
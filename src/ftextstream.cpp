@@ -22,6 +22,7 @@ class QGStringBuffer : public QIODevice
 
   protected:
     QGString* m_str;
+    void  reserve( uint len );
 
   private:        // Disabled copy constructor and operator=
     QGStringBuffer( const QGStringBuffer & );
@@ -115,11 +116,26 @@ bool  QGStringBuffer::at( int pos )
   return TRUE;
 }
 
+/*! Makes sure there is room for \a len more characters after the
+ *  current position. The string grows geometrically, QGString::enlarge()
+ *  itself only rounds to the next 64 bytes, which makes appending a
+ *  large document one character at a time quadratic.
+ */
+inline void QGStringBuffer::reserve( uint len )
+{
+  uint needed = ioIndex+len+1;
+  if (needed>m_str->size())
+  {
+    uint newSize = m_str->size()*2;
+    m_str->enlarge(newSize>needed ? newSize : needed);
+  }
+}
+
 int QGStringBuffer::writeBlock( const char *p, uint len )
 {
   //printf("QGStringBuffer::writeBlock(%p,%d) m_str=%p ioIndex=%d\n",p,len,
   //    m_str,ioIndex);
-  m_str->enlarge(ioIndex+len+1);
+  reserve(len);
   memcpy(m_str->data()+ioIndex,p,len);
   ioIndex+=len;
   m_str->data()[ioIndex]='\0';
@@ -131,7 +147,7 @@ int QGStringBuffer::putch( int ch )
 {
   //printf("QGStringBuffer::putch(%d) m_str=%p ioIndex=%d\n",
   //    ch,m_str,ioIndex);
-  m_str->enlarge(ioIndex+2);
+  reserve(1);
   m_str->data()[ioIndex] = (char)ch;
   ioIndex++;
   m_str->data()[ioIndex] = '\0';
@@ -48,9 +48,10 @@ struct FTVNode
           const char *n,bool sepIndex,bool navIndex,Definition *df)
     : isLast(TRUE), isDir(dir),ref(r),file(f),anchor(a),name(n), index(0),
       parent(0), separateIndex(sepIndex), addToNavIndex(navIndex),
-      def(df) { children.setAutoDelete(TRUE); }
+      def(df), treeSize(1) { children.setAutoDelete(TRUE); }
   int computeTreeDepth(int level) const;
   int numNodesAtLevel(int level,int maxLevel) const;
+  int computeTreeSize();
   bool isLast;
   bool isDir;
   QCString ref;
@@ -63,6 +64,7 @@ struct FTVNode
   bool separateIndex;
   bool addToNavIndex;
   Definition *def;
+  int treeSize; // number of nodes in the tree rooted at this node
 };
 
 int FTVNode::computeTreeDepth(int level) const
@@ -97,6 +99,18 @@ int FTVNode::numNodesAtLevel(int level,int maxLevel) const
   return num;
 }
 
+int FTVNode::computeTreeSize()
+{
+  treeSize=1; // this node
+  QListIterator<FTVNode> li(children);
+  FTVNode *n;
+  for (;(n=li.current());++li)
+  {
+    treeSize+=n->computeTreeSize();
+  }
+  return treeSize;
+}
+
 //----------------------------------------------------------------------------
 
 /*! Constructs an ftv help object.
@@ -317,14 +331,14 @@ static void generateBriefDoc(FTextStream &t,Definition *def)
   //printf("*** %p: generateBriefDoc(%s)='%s'\n",def,def->name().data(),brief.data());
   if (!brief.isEmpty())
   {
-    DocNode *root = validatingParseDoc(def->briefFile(),def->briefLine(),
+    DocNode *root = validatingParseDocCached(def->briefFile(),def->briefLine(),
         def,0,brief,FALSE,FALSE,0,TRUE,TRUE);
     QCString relPath = relativePathToRoot(def->getOutputFileBase());
     HtmlCodeGenerator htmlGen(t,relPath);
     HtmlDocVisitor *visitor = new HtmlDocVisitor(t,htmlGen,def);
     root->accept(visitor);
     delete visitor;
-    delete root;
+    releaseParsedDoc(root);
   }
 }
 
@@ -493,6 +507,33 @@ static QCString convertFileId2Var(const QCString &fileId)
   return substitute(varId,"-","_");
 }
 
+/** Nodes whose tree is larger than this have their children written to
+ *  a separate script, which navtree.js only loads when the node is expanded.
+ */
+static const int maxInlineTreeSize = 200;
+
+static QCString navTreeFileId(FTVNode *n)
+{
+  if (n->separateIndex)
+  {
+    QCString fileId = n->file;
+    if (n->anchor)
+    {
+      fileId+="_"+n->anchor;
+    }
+    if (dupOfParent(n))
+    {
+      fileId+="_dup";
+    }
+    return fileId;
+  }
+  else // the same page can appear in several places in the tree,
+       // so use the position of the node as a unique name
+  {
+    return "navtree_"+substitute(pathToNode(n,n),",","_");
+  }
+}
+
 static bool generateJSTree(NavIndexEntryList &navIndex,FTextStream &t,
                            const QList<FTVNode> &nl,int level,bool &first)
 {
@@ -537,22 +578,14 @@ static bool generateJSTree(NavIndexEntryList &navIndex,FTextStream &t,
       }
     }
 
-    if (n->separateIndex) // store items in a separate file for dynamic loading
+    if (n->separateIndex || n->treeSize>maxInlineTreeSize) // store items in a separate file for dynamic loading
     {
       bool firstChild=TRUE;
       t << indentStr << "  [ ";
       generateJSLink(t,n);
       if (n->children.count()>0) // write children to separate file for dynamic loading
       {
-        QCString fileId = n->file;
-        if (n->anchor)
-        {
-          fileId+="_"+n->anchor;
-        }
-        if (dupOfParent(n))
-        {
-          fileId+="_dup";
-        }
+        QCString fileId = navTreeFileId(n);
         QFile f(htmlOutput+"/"+fileId+".js");
         if (f.open(IO_WriteOnly))
         {
@@ -637,6 +670,13 @@ static void generateJSNavTree(const QList<FTVNode> &nodeList)
     // related page index is written as a child of index.html, so add this as well
     navIndex.append(new NavIndexEntry("pages"+Doxygen::htmlFileExtension,""));
 
+    QListIterator<FTVNode> nli(nodeList);
+    FTVNode *n;
+    for (nli.toFirst();(n=nli.current());++nli)
+    {
+      n->computeTreeSize();
+    }
+
     bool first=TRUE;
     generateJSTree(navIndex,t,nodeList,1,first);
 
@@ -770,7 +770,7 @@ void GroupDef::writeBriefDescription(OutputList &ol)
 {
   if (hasBriefDescription())
   {
-    DocRoot *rootNode = validatingParseDoc(briefFile(),briefLine(),this,0,
+    DocRoot *rootNode = validatingParseDocCached(briefFile(),briefLine(),this,0,
                                 briefDescription(),TRUE,FALSE,0,TRUE,FALSE);
     if (rootNode && !rootNode->isEmpty())
     {
@@ -797,7 +797,7 @@ void GroupDef::writeBriefDescription(OutputList &ol)
       ol.popGeneratorState();
       ol.endParagraph();
     }
-    delete rootNode;
+    releaseParsedDoc(rootNode);
   }
   ol.writeSynopsis();
 }
@@ -13,14 +13,14 @@ class GrowBuf
     GrowBuf() : str(0), pos(0), len(0) {}
    ~GrowBuf()         { free(str); str=0; pos=0; len=0; }
     void clear()      { pos=0; }
-    void addChar(char c)  { if (pos>=len) { len+=GROW_AMOUNT; str = (char*)realloc(str,len); } 
+    void addChar(char c)  { if (pos>=len) reserve(1);
                         str[pos++]=c; 
                       }
     void addStr(const char *s) {
                         if (s)
                         {
                           int l=strlen(s);
-                          if (pos+l>=len) { len+=l+GROW_AMOUNT; str = (char*)realloc(str,len); }
+                          if (pos+l>=len) reserve(l);
                           strcpy(&str[pos],s);
                           pos+=l;
                         }
@@ -28,10 +28,10 @@ class GrowBuf
     void addStr(const char *s,int n) {
                         if (s)
                         {
-                          int l=strlen(s);
-                          if (n<l) l=n;
-                          if (pos+l>=len) { len+=l+GROW_AMOUNT; str = (char*)realloc(str,len); }
-                          strncpy(&str[pos],s,n);
+                          const char *e=(const char *)memchr(s,0,n);
+                          int l = e ? (int)(e-s) : n;
+                          if (pos+l>=len) reserve(l);
+                          memcpy(&str[pos],s,l);
                           pos+=l;
                         }
                       }
@@ -39,6 +39,10 @@ class GrowBuf
     int getPos() const    { return pos; }
     char at(int i) const  { return str[i]; }
   private:
+    void reserve(int l) { // grow geometrically, so large buffers are not copied over and over
+                          len+=l+(len>GROW_AMOUNT ? len : GROW_AMOUNT);
+                          str = (char*)realloc(str,len);
+                        }
     char *str;
     int pos;
     int len;
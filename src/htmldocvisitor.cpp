@@ -569,7 +569,7 @@ void HtmlDocVisitor::visit(DocInclude *inc)
          Doxygen::parserManager->getParser(inc->extension())
                                ->parseCode(m_ci,
                                            inc->context(),
-                                           extractBlock(inc->text(),inc->blockId()),
+                                           inc->blockText(),
                                            langExt,
                                            inc->isExample(),
                                            inc->exampleFile(), 
@@ -594,12 +594,12 @@ void HtmlDocVisitor::visit(DocInclude *inc)
          Doxygen::parserManager->getParser(inc->extension())
                                ->parseCode(m_ci,
                                            inc->context(),
-                                           extractBlock(inc->text(),inc->blockId()),
+                                           inc->blockText(),
                                            langExt,
                                            inc->isExample(),
                                            inc->exampleFile(), 
                                            &fd,
-                                           lineBlock(inc->text(),inc->blockId()),
+                                           inc->blockLine(),
                                            -1,    // endLine
                                            FALSE, // inlineFragment
                                            0,     // memberDef
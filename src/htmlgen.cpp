@@ -438,13 +438,29 @@ void HtmlCodeGenerator::setRelativePath(const QCString &path)
 void HtmlCodeGenerator::codify(const char *str)
 {
   static int tabSize = Config_getInt(TAB_SIZE);
+  static const EscapeCharTable special("\t\n\r<>&'\"\\");
   if (str && m_streamSet)
   {
     const char *p=str;
     char c;
+    uchar b;
     int spacesToNextTabStop;
     while (*p)
     {
+      // write the characters that need no escaping in one go
+      const char *q=p;
+      while (!special.contains(b=(uchar)*q))
+      {
+        // like writeUtf8Char(), a lead byte takes the next byte along
+        q += (b>=0xC0 && b<=0xFD && q[1]) ? 2 : 1;
+        m_col++;
+      }
+      if (q>p)
+      {
+        m_t.device()->writeBlock(p,q-p);
+        p=q;
+        if (*p==0) break;
+      }
       c=*p++;
       switch(c)
       {
@@ -475,9 +491,6 @@ void HtmlCodeGenerator::codify(const char *str)
                      m_t << "\\";
                    m_col++;
                    break;
-        default:   p=writeUtf8Char(m_t,p-1);
-                   m_col++;
-                   break;
       }
     }
   }
@@ -485,6 +498,7 @@ void HtmlCodeGenerator::codify(const char *str)
 
 void HtmlCodeGenerator::docify(const char *str)
 {
+  static const EscapeCharTable special("<>&\"\\");
   m_t << getHtmlDirEmbedingChar(getTextDirByConfig(str));
 
   if (str && m_streamSet)
@@ -493,6 +507,14 @@ void HtmlCodeGenerator::docify(const char *str)
     char c;
     while (*p)
     {
+      // write the characters that need no escaping in one go
+      const char *q=special.skip(p);
+      if (q>p)
+      {
+        m_t.device()->writeBlock(p,q-p);
+        p=q;
+        if (*p==0) break;
+      }
       c=*p++;
       switch(c)
       {
@@ -508,7 +530,6 @@ void HtmlCodeGenerator::docify(const char *str)
                    else
                      m_t << "\\";
                    break;
-        default:   m_t << c;
       }
     }
   }
@@ -451,7 +451,7 @@ void LatexDocVisitor::visit(DocInclude *inc)
          Doxygen::parserManager->getParser(inc->extension())
                                ->parseCode(m_ci,
                                            inc->context(),
-                                           extractBlock(inc->text(),inc->blockId()),
+                                           inc->blockText(),
                                            langExt,
                                            inc->isExample(),
                                            inc->exampleFile()
@@ -467,12 +467,12 @@ void LatexDocVisitor::visit(DocInclude *inc)
          Doxygen::parserManager->getParser(inc->extension())
                                ->parseCode(m_ci,
                                            inc->context(),
-                                           extractBlock(inc->text(),inc->blockId()),
+                                           inc->blockText(),
                                            langExt,
                                            inc->isExample(),
                                            inc->exampleFile(), 
                                            &fd,
-                                           lineBlock(inc->text(),inc->blockId()),
+                                           inc->blockLine(),
                                            -1,    // endLine
                                            FALSE, // inlineFragment
                                            0,     // memberDef
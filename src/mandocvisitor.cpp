@@ -296,7 +296,7 @@ void ManDocVisitor::visit(DocInclude *inc)
       Doxygen::parserManager->getParser(inc->extension())
                             ->parseCode(m_ci,
                                         inc->context(),
-                                        extractBlock(inc->text(),inc->blockId()),
+                                        inc->blockText(),
                                         langExt,
                                         inc->isExample(),
                                         inc->exampleFile()
@@ -316,12 +316,12 @@ void ManDocVisitor::visit(DocInclude *inc)
          Doxygen::parserManager->getParser(inc->extension())
                                ->parseCode(m_ci,
                                            inc->context(),
-                                           extractBlock(inc->text(),inc->blockId()),
+                                           inc->blockText(),
                                            langExt,
                                            inc->isExample(),
                                            inc->exampleFile(), 
                                            &fd,
-                                           lineBlock(inc->text(),inc->blockId()),
+                                           inc->blockLine(),
                                            -1,    // endLine
                                            FALSE, // inlineFragment
                                            0,     // memberDef
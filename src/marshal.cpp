@@ -1,5 +1,7 @@
 #include <qfile.h>
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "sortdict.h"
 #include "marshal.h"
@@ -10,33 +12,41 @@
 #include "groupdef.h"
 #include "example.h"
 #include "arguments.h"
+#include "message.h"
 
 #define HEADER ('D'<<24)+('O'<<16)+('X'<<8)+'!'
 
+// Integers are stored as variable length quantities: 7 bits per byte,
+// least significant group first, with the high bit set on all but the
+// last byte. Signed values are zigzag encoded first so small negative
+// numbers (like the -1 used for unknown line numbers) stay short.
+
+static inline void marshalVarUInt(StorageIntf *s,uint64 v)
+{
+  uchar b[10];
+  int n=0;
+  while (v>=0x80)
+  {
+    b[n++]=(uchar)(v|0x80);
+    v>>=7;
+  }
+  b[n++]=(uchar)v;
+  s->write((const char *)b,n);
+}
+
 void marshalInt(StorageIntf *s,int v)
 {
-  uchar b[4];
-  b[0]=((uint)v)>>24;
-  b[1]=(((uint)v)>>16)&0xff;
-  b[2]=(((uint)v)>>8)&0xff;
-  b[3]=v&0xff;
-  s->write((const char *)b,4);
+  marshalVarUInt(s,(((uint)v)<<1)^(uint)(v>>31));
 }
 
 void marshalUInt(StorageIntf *s,uint v)
 {
-  uchar b[4];
-  b[0]=v>>24;
-  b[1]=(v>>16)&0xff;
-  b[2]=(v>>8)&0xff;
-  b[3]=v&0xff;
-  s->write((const char *)b,4);
+  marshalVarUInt(s,v);
 }
 
 void marshalUInt64(StorageIntf *s,uint64 v)
 {
-  marshalUInt(s, uint(v>>32));
-  marshalUInt(s, uint(v&0xFFFFFFFF));
+  marshalVarUInt(s,v);
 }
 
 void marshalBool(StorageIntf *s,bool b)
@@ -344,9 +354,38 @@ void marshalMemberLists(StorageIntf *s,SDict<MemberList> *mls)
   }
 }
 
-void marshalEntry(StorageIntf *s,Entry *e)
+//------------------------------------------------------------------
+
+#define BLOCK_HEADER_SIZE 12
+
+uint blockChecksum(const char *data,uint len)
+{
+  uint h=2166136261u;
+  const uchar *p=(const uchar *)data;
+  for (uint i=0;i<len;i++)
+  {
+    h^=p[i];
+    h*=16777619u;
+  }
+  return h;
+}
+
+static inline void putUInt32(char *p,uint v)
+{
+  p[0]=(char)(v>>24);
+  p[1]=(char)((v>>16)&0xff);
+  p[2]=(char)((v>>8)&0xff);
+  p[3]=(char)(v&0xff);
+}
+
+static inline uint getUInt32(const char *p)
+{
+  const uchar *b=(const uchar *)p;
+  return (((uint)b[0])<<24)+((uint)b[1]<<16)+((uint)b[2]<<8)+(uint)b[3];
+}
+
+static void marshalEntryFields(StorageIntf *s,Entry *e)
 {
-  marshalUInt(s,HEADER);
   marshalQCString(s,e->name);
   marshalQCString(s,e->type);
   marshalInt(s,e->section);
@@ -401,6 +440,21 @@ void marshalEntry(StorageIntf *s,Entry *e)
   marshalQCString(s,e->id);
 }
 
+/*! Writes entry \a e as a single block consisting of a fixed size header
+ *  (magic, length and checksum of the data) followed by the marshaled fields.
+ */
+void marshalEntry(StorageIntf *s,Entry *e)
+{
+  static BlockStorage block;
+  block.reset(BLOCK_HEADER_SIZE);
+  marshalEntryFields(&block,e);
+  uint len = block.size()-BLOCK_HEADER_SIZE;
+  putUInt32(block.data(),  HEADER);
+  putUInt32(block.data()+4,len);
+  putUInt32(block.data()+8,blockChecksum(block.data()+BLOCK_HEADER_SIZE,len));
+  s->write(block.data(),block.size());
+}
+
 void marshalEntryTree(StorageIntf *s,Entry *e)
 {
   marshalEntry(s,e);
@@ -415,29 +469,39 @@ void marshalEntryTree(StorageIntf *s,Entry *e)
 
 //------------------------------------------------------------------
 
+static inline uint64 unmarshalVarUInt(StorageIntf *s)
+{
+  uint64 result=0;
+  int shift=0;
+  uchar b;
+  do
+  {
+    if (s->read((char *)&b,1)!=1) break;
+    result|=((uint64)(b&0x7f))<<shift;
+    shift+=7;
+  }
+  while ((b&0x80) && shift<64);
+  return result;
+}
+
 int unmarshalInt(StorageIntf *s)
 {
-  uchar b[4];
-  s->read((char *)b,4);
-  int result=(int)((((uint)b[0])<<24)+((uint)b[1]<<16)+((uint)b[2]<<8)+(uint)b[3]);
-  //printf("unmarshalInt: %x %x %x %x: %x offset=%llx\n",b[0],b[1],b[2],b[3],result,f.pos());
+  uint v=(uint)unmarshalVarUInt(s);
+  int result=(int)((v>>1)^(0-(v&1)));
+  //printf("unmarshalInt: %x\n",result);
   return result;
 }
 
 uint unmarshalUInt(StorageIntf *s)
 {
-  uchar b[4];
-  s->read((char *)b,4);
-  uint result=(((uint)b[0])<<24)+((uint)b[1]<<16)+((uint)b[2]<<8)+(uint)b[3];
-  //printf("unmarshalUInt: %x %x %x %x: %x offset=%llx\n",b[0],b[1],b[2],b[3],result,f.pos());
+  uint result=(uint)unmarshalVarUInt(s);
+  //printf("unmarshalUInt: %x\n",result);
   return result;
 }
 
 uint64 unmarshalUInt64(StorageIntf *s)
 {
-  uint64 result=uint64(unmarshalUInt(s))<<32;
-  result|=unmarshalUInt(s);
-  return result;
+  return unmarshalVarUInt(s);
 }
 
 bool unmarshalBool(StorageIntf *s)
@@ -724,11 +788,9 @@ SDict<MemberList> *unmarshalMemberLists(StorageIntf *s)
   return result;
 }
 
-Entry * unmarshalEntry(StorageIntf *s)
+static Entry *unmarshalEntryFields(StorageIntf *s)
 {
   Entry *e = new Entry;
-  uint header=unmarshalUInt(s);
-  ASSERT(header==HEADER);
   e->name             = unmarshalQCString(s);
   e->type             = unmarshalQCString(s);
   e->section          = unmarshalInt(s);
@@ -788,6 +850,29 @@ Entry * unmarshalEntry(StorageIntf *s)
   return e;
 }
 
+Entry * unmarshalEntry(StorageIntf *s)
+{
+  static BlockStorage block;
+  char header[BLOCK_HEADER_SIZE];
+  if (s->read(header,BLOCK_HEADER_SIZE)!=BLOCK_HEADER_SIZE ||
+      getUInt32(header)!=(uint)HEADER)
+  {
+    err("Internal inconsistency: invalid entry block in the storage file\n");
+    return new Entry;
+  }
+  uint len = getUInt32(header+4);
+  block.reset(len);
+  if (len>0 && s->read(block.data(),len)!=(int)len)
+  {
+    err("Internal inconsistency: truncated entry block in the storage file\n");
+  }
+  else if (blockChecksum(block.data(),len)!=getUInt32(header+8))
+  {
+    err("Internal inconsistency: checksum mismatch for entry block in the storage file\n");
+  }
+  return unmarshalEntryFields(&block);
+}
+
 Entry * unmarshalEntryTree(StorageIntf *s)
 {
   Entry *e = unmarshalEntry(s);
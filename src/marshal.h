@@ -16,6 +16,8 @@
 #ifndef MARSHAL_H
 #define MARSHAL_H
 
+#include <stdlib.h>
+#include <string.h>
 #include <qlist.h>
 #include <qfile.h>
 #include "sortdict.h"
@@ -40,6 +42,64 @@ class Entry;
 
 #define NULL_LIST 0xffffffff
 
+/** @brief In-memory storage used to collect marshaled data.
+ *
+ *  Objects are marshaled into this buffer, after which the whole block is
+ *  written to the real storage with a single write. When reading, the block
+ *  is fetched with a single read and the fields are unmarshaled from memory.
+ */
+class BlockStorage : public StorageIntf
+{
+  public:
+    BlockStorage() : m_data(0), m_size(0), m_capacity(0), m_pos(0) {}
+   ~BlockStorage() { free(m_data); }
+    int write(const char *buf,uint size)
+    {
+      reserve(m_size+size);
+      memcpy(m_data+m_size,buf,size);
+      m_size+=size;
+      return size;
+    }
+    int read(char *buf,uint size)
+    {
+      uint avail = m_size-m_pos;
+      if (size>avail) // reading past the end of the block
+      {
+        memset(buf+avail,0,size-avail);
+        size=avail;
+      }
+      memcpy(buf,m_data+m_pos,size);
+      m_pos+=size;
+      return size;
+    }
+    /*! Resets the block to \a size bytes and rewinds the read position */
+    void reset(uint size)
+    {
+      reserve(size);
+      m_size=size;
+      m_pos=0;
+    }
+    char *data() const { return m_data; }
+    uint size() const  { return m_size; }
+    uint pos() const   { return m_pos; }
+  private:
+    void reserve(uint size)
+    {
+      if (size>m_capacity)
+      {
+        m_capacity = QMAX(QMAX(size,m_capacity*2),4096);
+        m_data = (char *)realloc(m_data,m_capacity);
+      }
+    }
+    char *m_data;
+    uint  m_size;
+    uint  m_capacity;
+    uint  m_pos;
+};
+
+/*! Computes the FNV-1a hash of a block, used to detect corrupted blocks. */
+uint blockChecksum(const char *data,uint len);
+
 //----- marshaling function: datatype -> byte stream --------------------
 
 void marshalInt(StorageIntf *s,int v);
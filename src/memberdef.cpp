@@ -1829,7 +1829,7 @@ void MemberDef::writeDeclaration(OutputList &ol,
       /* && !annMemb */
      )
   {
-    DocRoot *rootNode = validatingParseDoc(briefFile(),briefLine(),
+    DocRoot *rootNode = validatingParseDocCached(briefFile(),briefLine(),
                 getOuterScope()?getOuterScope():d,this,briefDescription(),
                 TRUE,FALSE,0,TRUE,FALSE);
 
@@ -1869,7 +1869,7 @@ void MemberDef::writeDeclaration(OutputList &ol,
       ol.popGeneratorState();
       ol.endMemberDescription();
     }
-    delete rootNode;
+    releaseParsedDoc(rootNode);
   }
 
   ol.endMemberDeclaration(anchor(),inheritId);
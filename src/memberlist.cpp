@@ -15,6 +15,8 @@
  *
  */
 
+#include <stdlib.h>
+
 #include <qregexp.h>
 
 #include "memberlist.h"
@@ -248,9 +250,55 @@ void MemberList::remove(const MemberDef *md)
   QList<MemberDef>::remove(md);
 }
 
+/** Sort key of a member, computed once per member instead of once per
+ *  comparison, since isConstructor() and isDestructor() are not cheap.
+ */
+struct MemberSortKey
+{
+  int order;        // 2 for constructors, 1 for destructors, 0 otherwise
+  const char *name;
+  int line;
+  uint index;       // position in the unsorted list, keeps the sort stable
+  MemberDef *md;
+};
+
+static int compareMemberSortKeys(const void *p1,const void *p2)
+{
+  const MemberSortKey *k1 = (const MemberSortKey *)p1;
+  const MemberSortKey *k2 = (const MemberSortKey *)p2;
+  if (k1->order!=k2->order) return k2->order-k1->order;
+  int cmp = qstricmp(k1->name,k2->name);
+  if (cmp!=0) return cmp;
+  if (k1->line!=k2->line) return k1->line-k2->line;
+  return k1->index<k2->index ? -1 : 1;
+}
+
+/** Sorts the list in the order defined by compareValues() */
 void MemberList::sort()
 {
-  QList<MemberDef>::sort();
+  static bool sortConstructorsFirst = Config_getBool(SORT_MEMBERS_CTORS_1ST);
+  uint n = count();
+  if (n<2) return;
+  MemberSortKey *keys = new MemberSortKey[n];
+  QListIterator<MemberDef> mli(*this);
+  MemberDef *md;
+  uint i=0;
+  for (mli.toFirst();(md=mli.current());++mli,++i)
+  {
+    keys[i].order = !sortConstructorsFirst ? 0 :
+                    md->isConstructor() ? 2 : md->isDestructor() ? 1 : 0;
+    keys[i].name  = md->name().data();
+    keys[i].line  = md->getDefLine();
+    keys[i].index = i;
+    keys[i].md    = md;
+  }
+  qsort(keys,n,sizeof(MemberSortKey),compareMemberSortKeys);
+  QList<MemberDef>::clear();
+  for (i=0;i<n;i++)
+  {
+    QList<MemberDef>::append(keys[i].md);
+  }
+  delete[] keys;
 }
 
 uint MemberList::count() const
@@ -429,7 +477,7 @@ void MemberList::writePlainDeclarations(OutputList &ol,
               ol.endMemberItem();
               if (!md->briefDescription().isEmpty() && Config_getBool(BRIEF_MEMBER_DESC))
               {
-                DocRoot *rootNode = validatingParseDoc(
+                DocRoot *rootNode = validatingParseDocCached(
                     md->briefFile(),md->briefLine(),
                     cd,md,
                     md->briefDescription(),
@@ -451,7 +499,7 @@ void MemberList::writePlainDeclarations(OutputList &ol,
                   }
                   ol.endMemberDescription();
                 }
-                delete rootNode;
+                releaseParsedDoc(rootNode);
               }
               ol.endMemberDeclaration(md->anchor(),inheritId);
             }
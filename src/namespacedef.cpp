@@ -403,7 +403,7 @@ void NamespaceDef::writeBriefDescription(OutputList &ol)
 {
   if (hasBriefDescription())
   {
-    DocRoot *rootNode = validatingParseDoc(briefFile(),briefLine(),this,0,
+    DocRoot *rootNode = validatingParseDocCached(briefFile(),briefLine(),this,0,
                         briefDescription(),TRUE,FALSE,0,TRUE,FALSE);
     if (rootNode && !rootNode->isEmpty())
     {
@@ -428,7 +428,7 @@ void NamespaceDef::writeBriefDescription(OutputList &ol)
       ol.popGeneratorState();
       ol.endParagraph();
     }
-    delete rootNode;
+    releaseParsedDoc(rootNode);
 
     // FIXME:PARA
     //ol.pushGeneratorState();
@@ -22,6 +22,7 @@
 #include "outputgen.h"
 #include "message.h"
 #include "portable.h"
+#include "outputmanifest.h"
 
 OutputGenerator::OutputGenerator()
 {
@@ -43,7 +44,7 @@ void OutputGenerator::startPlainFile(const char *name)
 {
   //printf("startPlainFile(%s)\n",name);
   fileName=dir+"/"+name;
-  file = new QFile(fileName);
+  file = new ManifestFile(fileName);
   if (!file->open(IO_WriteOnly))
   {
     err("Could not open file %s for writing\n",fileName.data());
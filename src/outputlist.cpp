@@ -146,15 +146,15 @@ bool OutputList::generateDoc(const char *fileName,int startLine,
   if (count==0) return TRUE; // no output formats enabled.
 
   DocRoot *root=0;
-  root = validatingParseDoc(fileName,startLine,
-                            ctx,md,docStr,indexWords,isExample,exampleName,
-                            singleLine,linkFromIndex);
+  root = validatingParseDocCached(fileName,startLine,
+                                  ctx,md,docStr,indexWords,isExample,exampleName,
+                                  singleLine,linkFromIndex);
 
   writeDoc(root,ctx,md);
 
   bool isEmpty = root->isEmpty();
 
-  delete root;
+  releaseParsedDoc(root);
 
   return isEmpty;
 }
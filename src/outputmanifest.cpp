@@ -0,0 +1,271 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2015 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+
+#include <stdlib.h>
+
+#include <qbuffer.h>
+#include <qdict.h>
+#include <qfileinfo.h>
+#include <qstrlist.h>
+
+#include "outputmanifest.h"
+#include "message.h"
+#include "config.h"
+#include "util.h"
+#include "md5.h"
+#include "ftextstream.h"
+
+//-----------------------------------------------------------------------------
+
+static const char *manifestFileName = "doxygen_manifest.txt";
+static const char *changesFileName  = "doxygen_changes.txt";
+
+/** hash of each page written by the previous run, indexed by relative path */
+static QDict<QCString> g_prevManifest(100003);
+/** hash of each page written by this run, indexed by relative path */
+static QDict<QCString> g_curManifest(100003);
+static bool g_manifestActive = FALSE;
+static int g_numWritten   = 0;
+static int g_numUnchanged = 0;
+
+/** Returns the path of \a fileName relative to the output directory,
+ *  so the manifest stays valid if the output directory is moved.
+ */
+static QCString manifestKey(const QString &fileName)
+{
+  QCString key = fileName.utf8();
+  QCString outDir = Config_getString(OUTPUT_DIRECTORY)+"/";
+  if (key.left(outDir.length())==outDir)
+  {
+    key = key.mid(outDir.length());
+  }
+  return key;
+}
+
+//-----------------------------------------------------------------------------
+
+bool OutputManifest::isEnabled()
+{
+  return g_manifestActive;
+}
+
+void OutputManifest::init()
+{
+  g_prevManifest.setAutoDelete(TRUE);
+  g_curManifest.setAutoDelete(TRUE);
+  g_prevManifest.clear();
+  g_curManifest.clear();
+  g_numWritten   = 0;
+  g_numUnchanged = 0;
+  g_manifestActive = Config_getBool(INCREMENTAL_OUTPUT);
+  if (!g_manifestActive) return;
+
+  QCString manifestName = Config_getString(OUTPUT_DIRECTORY)+"/"+manifestFileName;
+  QFileInfo fi(manifestName);
+  if (!fi.exists()) return;
+
+  // each line has the form "<md5> <path>"
+  QCString contents = fileToString(manifestName);
+  const char *p = contents.data();
+  while (p && *p)
+  {
+    const char *e = strchr(p,'\n');
+    int len = e ? (int)(e-p) : qstrlen(p);
+    if (len>33 && p[32]==' ')
+    {
+      QCString path(p+33,len-33+1);
+      g_prevManifest.replace(path,new QCString(p,33));
+    }
+    p = e ? e+1 : 0;
+  }
+}
+
+bool OutputManifest::writeFile(const QString &fileName,const char *data,uint len)
+{
+  uchar md5_sig[16];
+  QCString sigStr(33);
+  MD5Buffer((const unsigned char *)data,len,md5_sig);
+  MD5SigToString(md5_sig,sigStr.rawData(),33);
+
+  QCString key = manifestKey(fileName);
+  g_curManifest.replace(key,new QCString(sigStr));
+
+  QCString *prevSig = g_prevManifest.find(key);
+  if (prevSig && *prevSig==sigStr)
+  {
+    QFileInfo fi(fileName);
+    if (fi.exists() && fi.size()==len)
+    {
+      // same contents as the page written by the previous run
+      g_numUnchanged++;
+      return TRUE;
+    }
+  }
+
+  QFile f(fileName);
+  if (!f.open(IO_WriteOnly))
+  {
+    err("Could not open file %s for writing\n",fileName.data());
+    return FALSE;
+  }
+  if (len>0 && f.writeBlock(data,len)!=(int)len)
+  {
+    err("Could not write %d bytes to file %s\n",len,fileName.data());
+    return FALSE;
+  }
+  g_numWritten++;
+  return TRUE;
+}
+
+void OutputManifest::finish()
+{
+  if (!g_manifestActive) return;
+  g_manifestActive = FALSE;
+
+  QCString outDir = Config_getString(OUTPUT_DIRECTORY);
+
+  // write the new manifest, sorted so it can be diffed between runs
+  QStrList paths;
+  QDictIterator<QCString> it(g_curManifest);
+  QCString *sig;
+  for (;(sig=it.current());++it)
+  {
+    paths.append(it.currentKey());
+  }
+  paths.sort();
+
+  QFile mf(outDir+"/"+manifestFileName);
+  if (!mf.open(IO_WriteOnly))
+  {
+    err("Could not open file %s for writing\n",mf.name().data());
+    return;
+  }
+  FTextStream mt(&mf);
+  const char *path;
+  for (path=paths.first();path;path=paths.next())
+  {
+    mt << *g_curManifest.find(path) << " " << path << "\n";
+  }
+
+  // write the list of pages that were added, modified, or are no longer generated
+  QFile cf(outDir+"/"+changesFileName);
+  if (!cf.open(IO_WriteOnly))
+  {
+    err("Could not open file %s for writing\n",cf.name().data());
+    return;
+  }
+  FTextStream ct(&cf);
+  int numAdded=0,numModified=0,numRemoved=0;
+  for (path=paths.first();path;path=paths.next())
+  {
+    QCString *prevSig = g_prevManifest.find(path);
+    if (prevSig==0)
+    {
+      ct << "A " << path << "\n";
+      numAdded++;
+    }
+    else if (*prevSig!=*g_curManifest.find(path))
+    {
+      ct << "M " << path << "\n";
+      numModified++;
+    }
+  }
+  QStrList removed;
+  QDictIterator<QCString> pit(g_prevManifest);
+  for (;(sig=pit.current());++pit)
+  {
+    if (g_curManifest.find(pit.currentKey())==0)
+    {
+      removed.append(pit.currentKey());
+    }
+  }
+  removed.sort();
+  for (path=removed.first();path;path=removed.next())
+  {
+    ct << "D " << path << "\n";
+    numRemoved++;
+  }
+
+  msg("Incremental output: %d pages written, %d unchanged "
+      "(%d added, %d modified, %d removed)\n",
+      g_numWritten,g_numUnchanged,numAdded,numModified,numRemoved);
+
+  g_prevManifest.clear();
+  g_curManifest.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+ManifestFile::ManifestFile(const QString &name) : QFile(name), m_buffer(0)
+{
+}
+
+ManifestFile::~ManifestFile()
+{
+  close();
+}
+
+bool ManifestFile::open(int m)
+{
+  if (OutputManifest::isEnabled() &&
+      (m & IO_ReadWrite)==IO_WriteOnly && (m & IO_Append)==0)
+  {
+    // collect the page in memory, it is written on close()
+    m_buffer = new QBuffer;
+    m_buffer->open(IO_WriteOnly);
+    setMode(m);
+    setState(IO_Open);
+    return TRUE;
+  }
+  return QFile::open(m);
+}
+
+void ManifestFile::close()
+{
+  if (m_buffer)
+  {
+    QByteArray data = m_buffer->buffer();
+    OutputManifest::writeFile(name(),data.data(),m_buffer->size());
+    delete m_buffer;
+    m_buffer = 0;
+    setFlags(IO_Direct);
+    return;
+  }
+  QFile::close();
+}
+
+void ManifestFile::flush()
+{
+  if (m_buffer) return;
+  QFile::flush();
+}
+
+uint ManifestFile::size() const
+{
+  if (m_buffer) return m_buffer->size();
+  return QFile::size();
+}
+
+int ManifestFile::writeBlock(const char *data,uint len)
+{
+  if (m_buffer) return m_buffer->writeBlock(data,len);
+  return QFile::writeBlock(data,len);
+}
+
+int ManifestFile::putch(int ch)
+{
+  if (m_buffer) return m_buffer->putch(ch);
+  return QFile::putch(ch);
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+ *
+ * Copyright (C) 1997-2015 by Dimitri van Heesch.
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation under the terms of the GNU General Public License is hereby
+ * granted. No representations are made about the suitability of this software
+ * for any purpose. It is provided "as is" without express or implied warranty.
+ * See the GNU General Public License for more details.
+ *
+ * Documents produced by Doxygen are derivative works derived from the
+ * input used in their production; they are not affected by this license.
+ *
+ */
+#ifndef OUTPUTMANIFEST_H
+#define OUTPUTMANIFEST_H
+
+#include <qfile.h>
+
+class QBuffer;
+
+/** @brief Drop-in replacement for QFile for writing generated pages.
+ *
+ *  If INCREMENTAL_OUTPUT is enabled, the page is collected in memory and
+ *  only written to disk on close() if it differs from the previous run.
+ *  Otherwise it is a plain QFile.
+ */
+class ManifestFile : public QFile
+{
+  public:
+    ManifestFile(const QString &name);
+   ~ManifestFile();
+    bool open(int m);
+    void close();
+    void flush();
+    uint size() const;
+    int  writeBlock(const char *data,uint len);
+    int  writeBlock(const QByteArray &data)
+         { return QIODevice::writeBlock(data); }
+    int  putch(int ch);
+
+  private:
+    QBuffer *m_buffer; // contents of the page, 0 if writing to the file directly
+};
+
+/** This class is a namespace for the manifest of generated pages */
+struct OutputManifest
+{
+  static bool isEnabled();
+  /** Reads the manifest written by the previous run */
+  static void init();
+  /** Writes the new manifest and the list of changed pages */
+  static void finish();
+  /** Writes \a len bytes at \a data to \a fileName, unless the file
+   *  already has that contents according to the manifest.
+   */
+  static bool writeFile(const QString &fileName,const char *data,uint len);
+};
+
+#endif /* OUTPUTMANIFEST_H */
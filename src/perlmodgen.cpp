@@ -1459,14 +1459,14 @@ static void addPerlModDocBlock(PerlModOutput &output,
   if (stext.isEmpty())
     output.addField(name).add("{}");
   else {
-    DocNode *root = validatingParseDoc(fileName,lineNr,scope,md,stext,FALSE,0);
+    DocNode *root = validatingParseDocCached(fileName,lineNr,scope,md,stext,FALSE,0);
     output.openHash(name);
     PerlModDocVisitor *visitor = new PerlModDocVisitor(output);
     root->accept(visitor);
     visitor->finish();
     output.closeHash();
     delete visitor;
-    delete root;
+    releaseParsedDoc(root);
   }
 }
 
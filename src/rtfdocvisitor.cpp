@@ -437,7 +437,7 @@ void RTFDocVisitor::visit(DocInclude *inc)
       Doxygen::parserManager->getParser(inc->extension())
                             ->parseCode(m_ci,
                                         inc->context(),
-                                        extractBlock(inc->text(),inc->blockId()),
+                                        inc->blockText(),
                                         langExt,
                                         inc->isExample(),
                                         inc->exampleFile()
@@ -454,12 +454,12 @@ void RTFDocVisitor::visit(DocInclude *inc)
          Doxygen::parserManager->getParser(inc->extension())
                                ->parseCode(m_ci,
                                            inc->context(),
-                                           extractBlock(inc->text(),inc->blockId()),
+                                           inc->blockText(),
                                            langExt,
                                            inc->isExample(),
                                            inc->exampleFile(), 
                                            &fd,
-                                           lineBlock(inc->text(),inc->blockId()),
+                                           inc->blockLine(),
                                            -1,    // endLine
                                            FALSE, // inlineFragment
                                            0,     // memberDef
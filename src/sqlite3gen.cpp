@@ -39,6 +39,7 @@
 #include "dirdef.h"
 
 #include <qdir.h>
+#include <qdict.h>
 #include <string.h>
 #include <sqlite3.h>
 
@@ -53,9 +54,7 @@ const char * schema_queries[][2] = {
       "\tlocal        INTEGER NOT NULL,\n"
       "\tid_src       INTEGER NOT NULL,  -- File id of the includer.\n"
       "\tid_dst       INTEGER NOT NULL   -- File id of the includee.\n"
-      ");\n"
-    "CREATE UNIQUE INDEX idx_includes ON includes\n"
-      "\t(local, id_src, id_dst);"
+      ");"
   },
   { "innerclass",
     "CREATE TABLE IF NOT EXISTS innerclass (\n"
@@ -85,9 +84,7 @@ const char * schema_queries[][2] = {
       "\tid_file      INTEGER NOT NULL, -- file where the reference is happening.\n"
       "\tline         INTEGER NOT NULL, -- line where the reference is happening.\n"
       "\tcolumn       INTEGER NOT NULL  -- column where the reference is happening.\n"
-      ");\n"
-    "CREATE UNIQUE INDEX idx_xrefs ON xrefs\n"
-      "\t(refid_src, refid_dst, id_file, line, column);"
+      ");"
   },
   { "memberdef",
     "CREATE TABLE IF NOT EXISTS memberdef (\n"
@@ -217,6 +214,20 @@ const char * schema_queries[][2] = {
   }
 };
 
+// Indexes that are only created after all data has been inserted. The
+// generator itself never queries these tables, it keeps track of the rows
+// it already inserted in memory instead.
+const char * index_queries[][2] = {
+  { "idx_includes",
+    "CREATE UNIQUE INDEX idx_includes ON includes\n"
+      "\t(local, id_src, id_dst);"
+  },
+  { "idx_xrefs",
+    "CREATE UNIQUE INDEX idx_xrefs ON xrefs\n"
+      "\t(refid_src, refid_dst, id_file, line, column);"
+  }
+};
+
 //////////////////////////////////////////////////////
 struct SqlStmt {
   const char   *query;
@@ -230,10 +241,6 @@ SqlStmt incl_insert = { "INSERT INTO includes "
     "(:local,:id_src,:id_dst )"
     ,NULL
 };
-SqlStmt incl_select = { "SELECT COUNT(*) FROM includes WHERE "
-  "local=:local AND id_src=:id_src AND id_dst=:id_dst"
-    ,NULL
-};
 //////////////////////////////////////////////////////
 SqlStmt innerclass_insert={"INSERT INTO innerclass "
     "( refid, prot, name )"
@@ -242,9 +249,6 @@ SqlStmt innerclass_insert={"INSERT INTO innerclass "
     ,NULL
 };
 //////////////////////////////////////////////////////
-SqlStmt files_select = {"SELECT rowid FROM files WHERE name=:name"
-  ,NULL
-};
 SqlStmt files_insert = {"INSERT INTO files "
   "( name )"
     "VALUES "
@@ -252,10 +256,6 @@ SqlStmt files_insert = {"INSERT INTO files "
     ,NULL
 };
 //////////////////////////////////////////////////////
-SqlStmt refids_select =  {"SELECT rowid FROM refids WHERE "
-  "refid=:refid"
-    ,NULL
-};
 SqlStmt refids_insert = {"INSERT INTO refids "
   "( refid )"
     "VALUES "
@@ -520,34 +520,64 @@ static int step(SqlStmt &s,bool getRowId=FALSE, bool select=FALSE)
   return rowid;
 }
 
-static int insertFile(const char* name)
+// rows that were already inserted, so duplicates can be skipped without
+// querying the database
+static QDict<int>  g_fileIds(10007);
+static QDict<int>  g_refIds(10007);
+static QDict<void> g_includes(10007);
+static QDict<void> g_xrefs(10007);
+
+static void clearInsertedRows()
+{
+  g_fileIds.setAutoDelete(TRUE);
+  g_refIds.setAutoDelete(TRUE);
+  g_fileIds.clear();
+  g_refIds.clear();
+  g_includes.clear();
+  g_xrefs.clear();
+}
+
+/*! Returns the rowid of \a name in the table that \a s inserts into,
+ *  inserting it first if it is not yet in \a ids.
+ */
+static int insertUniqueName(SqlStmt &s,const char *param,QDict<int> &ids,const char *name)
 {
   int rowid=-1;
   if (name==0) return rowid;
 
-  bindTextParameter(files_select,":name",name);
-  rowid=step(files_select,TRUE,TRUE);
-  if (rowid==0)
+  int *id = ids.find(name);
+  if (id) return *id;
+  bindTextParameter(s,param,name);
+  rowid=step(s,TRUE);
+  if (rowid!=-1)
   {
-    bindTextParameter(files_insert,":name",name);
-    rowid=step(files_insert,TRUE);
+    ids.insert(name,new int(rowid));
   }
   return rowid;
 }
 
+static int insertFile(const char* name)
+{
+  return insertUniqueName(files_insert,":name",g_fileIds,name);
+}
+
 static int insertRefid(const char *refid)
 {
-  int rowid=-1;
-  if (refid==0) return rowid;
+  return insertUniqueName(refids_insert,":refid",g_refIds,refid);
+}
 
-  bindTextParameter(refids_select,":refid",refid);
-  rowid=step(refids_select,TRUE,TRUE);
-  if (rowid==0)
-  {
-    bindTextParameter(refids_insert,":refid",refid);
-    rowid=step(refids_insert,TRUE);
-  }
-  return rowid;
+static void insertInclude(int local,int id_src,int id_dst)
+{
+  if (id_src==-1 || id_dst==-1) return;
+  QCString key;
+  key.sprintf("%d:%d:%d",local,id_src,id_dst);
+  if (g_includes.find(key)) return;
+  g_includes.insert(key,(void*)0x8);
+
+  bindIntParameter(incl_insert,":local",local);
+  bindIntParameter(incl_insert,":id_src",id_src);
+  bindIntParameter(incl_insert,":id_dst",id_dst);
+  step(incl_insert);
 }
 
 
@@ -557,6 +587,11 @@ static bool insertMemberReference(int refid_src, int refid_dst,
   if (id_file==-1||refid_src==-1||refid_dst==-1)
     return false;
 
+  QCString key;
+  key.sprintf("%d:%d:%d:%d:%d",refid_src,refid_dst,id_file,line,column);
+  if (g_xrefs.find(key)) return true; // already inserted
+  g_xrefs.insert(key,(void*)0x8);
+
   if (
      !bindIntParameter(xrefs_insert,":refid_src",refid_src) ||
      !bindIntParameter(xrefs_insert,":refid_dst",refid_dst) ||
@@ -722,11 +757,8 @@ static int prepareStatements(sqlite3 *db)
   if (
   -1==prepareStatement(db, memberdef_insert) ||
   -1==prepareStatement(db, files_insert) ||
-  -1==prepareStatement(db, files_select) ||
   -1==prepareStatement(db, refids_insert) ||
-  -1==prepareStatement(db, refids_select) ||
   -1==prepareStatement(db, incl_insert)||
-  -1==prepareStatement(db, incl_select)||
   -1==prepareStatement(db, params_insert) ||
   -1==prepareStatement(db, params_select) ||
   -1==prepareStatement(db, xrefs_insert) ||
@@ -783,6 +815,25 @@ static int initializeSchema(sqlite3* db)
   return 0;
 }
 
+static int createIndexes(sqlite3* db)
+{
+  int rc;
+
+  msg("Creating DB indexes...\n");
+  for (unsigned int k = 0; k < sizeof(index_queries) / sizeof(index_queries[0]); k++)
+  {
+    const char *q = index_queries[k][1];
+    char *errmsg;
+    rc = sqlite3_exec(db, q, NULL, NULL, &errmsg);
+    if (rc != SQLITE_OK)
+    {
+      msg("failed to execute query: %s\n\t%s\n", q, errmsg);
+      return -1;
+    }
+  }
+  return 0;
+}
+
 ////////////////////////////////////////////
 static void writeInnerClasses(const ClassSDict *cl)
 {
@@ -1257,19 +1308,7 @@ static void generateSqlite3ForClass(const ClassDef *cd)
     if (!nm.isEmpty())
     {
       int id_dst=insertFile(nm);
-      if (id_dst!=-1) {
-        bindIntParameter(incl_select,":local",ii->local);
-        bindIntParameter(incl_select,":id_src",id_file);
-        bindIntParameter(incl_select,":id_dst",id_dst);
-        int count=step(incl_select,TRUE,TRUE);
-        if (count==0)
-        {
-          bindIntParameter(incl_insert,":local",ii->local);
-          bindIntParameter(incl_insert,":id_src",id_file);
-          bindIntParameter(incl_insert,":id_dst",id_dst);
-          step(incl_insert);
-        }
-      }
+      insertInclude(ii->local,id_file,id_dst);
     }
   }
   // + list of inner classes
@@ -1372,15 +1411,7 @@ static void generateSqlite3ForFile(const FileDef *fd)
     {
       int id_src=insertFile(fd->absFilePath().data());
       int id_dst=insertFile(ii->includeName.data());
-      bindIntParameter(incl_select,":local",ii->local);
-      bindIntParameter(incl_select,":id_src",id_src);
-      bindIntParameter(incl_select,":id_dst",id_dst);
-      if (step(incl_select,TRUE,TRUE)==0) {
-        bindIntParameter(incl_insert,":local",ii->local);
-        bindIntParameter(incl_insert,":id_src",id_src);
-        bindIntParameter(incl_insert,":id_dst",id_dst);
-        step(incl_insert);
-      }
+      insertInclude(ii->local,id_src,id_dst);
     }
   }
 
@@ -1392,15 +1423,7 @@ static void generateSqlite3ForFile(const FileDef *fd)
     {
       int id_src=insertFile(ii->includeName);
       int id_dst=insertFile(fd->absFilePath());
-      bindIntParameter(incl_select,":local",ii->local);
-      bindIntParameter(incl_select,":id_src",id_src);
-      bindIntParameter(incl_select,":id_dst",id_dst);
-      if (step(incl_select,TRUE,TRUE)==0) {
-        bindIntParameter(incl_insert,":local",ii->local);
-        bindIntParameter(incl_insert,":id_src",id_src);
-        bindIntParameter(incl_insert,":id_dst",id_dst);
-        step(incl_insert);
-      }
+      insertInclude(ii->local,id_src,id_dst);
     }
   }
 
@@ -1497,12 +1520,14 @@ void generateSqlite3()
   {
     return;
   }
-  beginTransaction(db);
   pragmaTuning(db);
+  beginTransaction(db);
 
   if (-1==initializeSchema(db))
     return;
 
+  clearInsertedRows();
+
   if ( -1 == prepareStatements(db) )
   {
     err("sqlite generator: prepareStatements failed!");
@@ -1590,6 +1615,8 @@ void generateSqlite3()
     generateSqlite3ForPage(Doxygen::mainPage,FALSE);
   }
 
+  createIndexes(db);
+  clearInsertedRows();
   endTransaction(db);
 }
 
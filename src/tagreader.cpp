@@ -39,6 +39,7 @@
 #include "filedef.h"
 #include "filename.h"
 #include "section.h"
+#include "marshal.h"
 
 /** Information about an linkable anchor */
 class TagAnchorInfo
@@ -277,11 +278,16 @@ class TagFileParser : public QXmlDefaultHandler
 
     void warn(const char *fmt)
     {
-      ::warn(m_inputFileName,m_locator->lineNumber(),fmt);
+      ::warn(m_inputFileName,lineNumber(),fmt);
     }
     void warn(const char *fmt,const char *s)
     {
-      ::warn(m_inputFileName,m_locator->lineNumber(),fmt,s);
+      ::warn(m_inputFileName,lineNumber(),fmt,s);
+    }
+    int lineNumber() const
+    {
+      // there is no locator when the data was read from the binary index
+      return m_locator ? m_locator->lineNumber() : 1;
     }
 
     void startCompound( const QXmlAttributes& attrib )
@@ -907,6 +913,8 @@ class TagFileParser : public QXmlDefaultHandler
     void dump();
     void buildLists(Entry *root);
     void addIncludes();
+    void writeIndex(StorageIntf *s);
+    void readIndex(StorageIntf *s);
     
   private:
     void buildMemberList(Entry *ce,QList<TagMemberInfo> &members);
@@ -1524,11 +1532,434 @@ void TagFileParser::addIncludes()
   }
 }
 
-void parseTagFile(Entry *root,const char *fullName)
+//---------------------------------------------------------------------------
+// Binary tag file index
+//
+// The index contains the information collected by TagFileParser in a
+// compact binary form, so a tag file can be loaded without running the XML
+// parser. It is stored next to the tag file (with an extra .idx extension)
+// and is only used when its header matches the size and modification time
+// of the tag file.
+//---------------------------------------------------------------------------
+
+#define TAGINDEX_MAGIC   (('D'<<24)+('T'<<16)+('A'<<8)+'G')
+#define TAGINDEX_VERSION 1
+
+static void marshalStringList(StorageIntf *s,const QStringList &l)
+{
+  marshalUInt(s,l.count());
+  for (QStringList::ConstIterator it=l.begin();it!=l.end();++it)
+  {
+    marshalQCString(s,(*it).utf8());
+  }
+}
+
+static void unmarshalStringList(StorageIntf *s,QStringList &l)
+{
+  uint i,count = unmarshalUInt(s);
+  for (i=0;i<count;i++)
+  {
+    l.append(QString::fromUtf8(unmarshalQCString(s)));
+  }
+}
+
+static void marshalAnchors(StorageIntf *s,const TagAnchorInfoList &l)
+{
+  marshalUInt(s,l.count());
+  QListIterator<TagAnchorInfo> tli(l);
+  TagAnchorInfo *ta;
+  for (tli.toFirst();(ta=tli.current());++tli)
+  {
+    marshalQCString(s,ta->fileName);
+    marshalQCString(s,ta->label);
+    marshalQCString(s,ta->title);
+  }
+}
+
+static void unmarshalAnchors(StorageIntf *s,TagAnchorInfoList &l)
+{
+  uint i,count = unmarshalUInt(s);
+  for (i=0;i<count;i++)
+  {
+    QCString fileName = unmarshalQCString(s);
+    QCString label    = unmarshalQCString(s);
+    QCString title    = unmarshalQCString(s);
+    l.append(new TagAnchorInfo(fileName,label,title));
+  }
+}
+
+static void marshalMembers(StorageIntf *s,const QList<TagMemberInfo> &l)
+{
+  marshalUInt(s,l.count());
+  QListIterator<TagMemberInfo> mii(l);
+  TagMemberInfo *tmi;
+  for (mii.toFirst();(tmi=mii.current());++mii)
+  {
+    marshalQCString(s,tmi->type);
+    marshalQCString(s,tmi->name);
+    marshalQCString(s,tmi->anchorFile);
+    marshalQCString(s,tmi->anchor);
+    marshalQCString(s,tmi->arglist);
+    marshalQCString(s,tmi->kind);
+    marshalQCString(s,tmi->clangId);
+    marshalAnchors(s,tmi->docAnchors);
+    marshalInt(s,(int)tmi->prot);
+    marshalInt(s,(int)tmi->virt);
+    marshalBool(s,tmi->isStatic);
+    marshalUInt(s,tmi->enumValues.count());
+    QListIterator<TagEnumValueInfo> evi(tmi->enumValues);
+    TagEnumValueInfo *evii;
+    for (evi.toFirst();(evii=evi.current());++evi)
+    {
+      marshalQCString(s,evii->name);
+      marshalQCString(s,evii->file);
+      marshalQCString(s,evii->anchor);
+      marshalQCString(s,evii->clangid);
+    }
+  }
+}
+
+static void unmarshalMembers(StorageIntf *s,QList<TagMemberInfo> &l)
+{
+  uint i,j,count = unmarshalUInt(s);
+  for (i=0;i<count;i++)
+  {
+    TagMemberInfo *tmi = new TagMemberInfo;
+    tmi->type       = unmarshalQCString(s);
+    tmi->name       = unmarshalQCString(s);
+    tmi->anchorFile = unmarshalQCString(s);
+    tmi->anchor     = unmarshalQCString(s);
+    tmi->arglist    = unmarshalQCString(s);
+    tmi->kind       = unmarshalQCString(s);
+    tmi->clangId    = unmarshalQCString(s);
+    unmarshalAnchors(s,tmi->docAnchors);
+    tmi->prot       = (Protection)unmarshalInt(s);
+    tmi->virt       = (Specifier)unmarshalInt(s);
+    tmi->isStatic   = unmarshalBool(s);
+    uint numValues  = unmarshalUInt(s);
+    for (j=0;j<numValues;j++)
+    {
+      TagEnumValueInfo *evii = new TagEnumValueInfo;
+      evii->name    = unmarshalQCString(s);
+      evii->file    = unmarshalQCString(s);
+      evii->anchor  = unmarshalQCString(s);
+      evii->clangid = unmarshalQCString(s);
+      tmi->enumValues.append(evii);
+    }
+    l.append(tmi);
+  }
+}
+
+/*! Writes the information gathered by the XML parser to storage \a s. */
+void TagFileParser::writeIndex(StorageIntf *s)
+{
+  // classes
+  marshalUInt(s,m_tagFileClasses.count());
+  QListIterator<TagClassInfo> cit(m_tagFileClasses);
+  TagClassInfo *tci;
+  for (cit.toFirst();(tci=cit.current());++cit)
+  {
+    marshalQCString(s,tci->name);
+    marshalQCString(s,tci->filename);
+    marshalQCString(s,tci->clangId);
+    marshalAnchors(s,tci->docAnchors);
+    marshalBaseInfoList(s,tci->bases);
+    marshalMembers(s,tci->members);
+    if (tci->templateArguments==0)
+    {
+      marshalUInt(s,NULL_LIST); // null pointer representation
+    }
+    else
+    {
+      marshalUInt(s,tci->templateArguments->count());
+      QListIterator<QCString> sli(*tci->templateArguments);
+      QCString *argName;
+      for (sli.toFirst();(argName=sli.current());++sli)
+      {
+        marshalQCString(s,*argName);
+      }
+    }
+    marshalStringList(s,tci->classList);
+    marshalInt(s,(int)tci->kind);
+    marshalBool(s,tci->isObjC);
+  }
+
+  // files
+  marshalUInt(s,m_tagFileFiles.count());
+  QListIterator<TagFileInfo> fit(m_tagFileFiles);
+  TagFileInfo *tfi;
+  for (fit.toFirst();(tfi=fit.current());++fit)
+  {
+    marshalQCString(s,tfi->name);
+    marshalQCString(s,tfi->path);
+    marshalQCString(s,tfi->filename);
+    marshalAnchors(s,tfi->docAnchors);
+    marshalMembers(s,tfi->members);
+    marshalStringList(s,tfi->classList);
+    marshalStringList(s,tfi->namespaceList);
+    marshalUInt(s,tfi->includes.count());
+    QListIterator<TagIncludeInfo> iii(tfi->includes);
+    TagIncludeInfo *ii;
+    for (iii.toFirst();(ii=iii.current());++iii)
+    {
+      marshalQCString(s,ii->id);
+      marshalQCString(s,ii->name);
+      marshalQCString(s,ii->text);
+      marshalBool(s,ii->isLocal);
+      marshalBool(s,ii->isImported);
+    }
+  }
+
+  // namespaces
+  marshalUInt(s,m_tagFileNamespaces.count());
+  QListIterator<TagNamespaceInfo> nit(m_tagFileNamespaces);
+  TagNamespaceInfo *tni;
+  for (nit.toFirst();(tni=nit.current());++nit)
+  {
+    marshalQCString(s,tni->name);
+    marshalQCString(s,tni->filename);
+    marshalQCString(s,tni->clangId);
+    marshalStringList(s,tni->classList);
+    marshalStringList(s,tni->namespaceList);
+    marshalAnchors(s,tni->docAnchors);
+    marshalMembers(s,tni->members);
+  }
+
+  // packages
+  marshalUInt(s,m_tagFilePackages.count());
+  QListIterator<TagPackageInfo> pit(m_tagFilePackages);
+  TagPackageInfo *tpgi;
+  for (pit.toFirst();(tpgi=pit.current());++pit)
+  {
+    marshalQCString(s,tpgi->name);
+    marshalQCString(s,tpgi->filename);
+    marshalAnchors(s,tpgi->docAnchors);
+    marshalMembers(s,tpgi->members);
+    marshalStringList(s,tpgi->classList);
+  }
+
+  // groups
+  marshalUInt(s,m_tagFileGroups.count());
+  QListIterator<TagGroupInfo> git(m_tagFileGroups);
+  TagGroupInfo *tgi;
+  for (git.toFirst();(tgi=git.current());++git)
+  {
+    marshalQCString(s,tgi->name);
+    marshalQCString(s,tgi->title);
+    marshalQCString(s,tgi->filename);
+    marshalAnchors(s,tgi->docAnchors);
+    marshalMembers(s,tgi->members);
+    marshalStringList(s,tgi->subgroupList);
+    marshalStringList(s,tgi->classList);
+    marshalStringList(s,tgi->namespaceList);
+    marshalStringList(s,tgi->fileList);
+    marshalStringList(s,tgi->pageList);
+    marshalStringList(s,tgi->dirList);
+  }
+
+  // pages
+  marshalUInt(s,m_tagFilePages.count());
+  QListIterator<TagPageInfo> pgit(m_tagFilePages);
+  TagPageInfo *tpi;
+  for (pgit.toFirst();(tpi=pgit.current());++pgit)
+  {
+    marshalQCString(s,tpi->name);
+    marshalQCString(s,tpi->title);
+    marshalQCString(s,tpi->filename);
+    marshalAnchors(s,tpi->docAnchors);
+  }
+
+  // dirs
+  marshalUInt(s,m_tagFileDirs.count());
+  QListIterator<TagDirInfo> dit(m_tagFileDirs);
+  TagDirInfo *tdi;
+  for (dit.toFirst();(tdi=dit.current());++dit)
+  {
+    marshalQCString(s,tdi->name);
+    marshalQCString(s,tdi->filename);
+    marshalQCString(s,tdi->path);
+    marshalStringList(s,tdi->subdirList);
+    marshalStringList(s,tdi->fileList);
+    marshalAnchors(s,tdi->docAnchors);
+  }
+}
+
+/*! Reads the information written by writeIndex() from storage \a s. */
+void TagFileParser::readIndex(StorageIntf *s)
+{
+  uint i,j,count;
+
+  // classes
+  count = unmarshalUInt(s);
+  for (i=0;i<count;i++)
+  {
+    TagClassInfo *tci = new TagClassInfo;
+    tci->name     = unmarshalQCString(s);
+    tci->filename = unmarshalQCString(s);
+    tci->clangId  = unmarshalQCString(s);
+    unmarshalAnchors(s,tci->docAnchors);
+    tci->bases    = unmarshalBaseInfoList(s);
+    unmarshalMembers(s,tci->members);
+    uint numArgs  = unmarshalUInt(s);
+    if (numArgs!=NULL_LIST)
+    {
+      tci->templateArguments = new QList<QCString>;
+      tci->templateArguments->setAutoDelete(TRUE);
+      for (j=0;j<numArgs;j++)
+      {
+        tci->templateArguments->append(new QCString(unmarshalQCString(s)));
+      }
+    }
+    unmarshalStringList(s,tci->classList);
+    tci->kind     = (TagClassInfo::Kind)unmarshalInt(s);
+    tci->isObjC   = unmarshalBool(s);
+    m_tagFileClasses.append(tci);
+  }
+
+  // files
+  count = unmarshalUInt(s);
+  for (i=0;i<count;i++)
+  {
+    TagFileInfo *tfi = new TagFileInfo;
+    tfi->name     = unmarshalQCString(s);
+    tfi->path     = unmarshalQCString(s);
+    tfi->filename = unmarshalQCString(s);
+    unmarshalAnchors(s,tfi->docAnchors);
+    unmarshalMembers(s,tfi->members);
+    unmarshalStringList(s,tfi->classList);
+    unmarshalStringList(s,tfi->namespaceList);
+    uint numIncludes = unmarshalUInt(s);
+    for (j=0;j<numIncludes;j++)
+    {
+      TagIncludeInfo *ii = new TagIncludeInfo;
+      ii->id         = unmarshalQCString(s);
+      ii->name       = unmarshalQCString(s);
+      ii->text       = unmarshalQCString(s);
+      ii->isLocal    = unmarshalBool(s);
+      ii->isImported = unmarshalBool(s);
+      tfi->includes.append(ii);
+    }
+    m_tagFileFiles.append(tfi);
+  }
+
+  // namespaces
+  count = unmarshalUInt(s);
+  for (i=0;i<count;i++)
+  {
+    TagNamespaceInfo *tni = new TagNamespaceInfo;
+    tni->name     = unmarshalQCString(s);
+    tni->filename = unmarshalQCString(s);
+    tni->clangId  = unmarshalQCString(s);
+    unmarshalStringList(s,tni->classList);
+    unmarshalStringList(s,tni->namespaceList);
+    unmarshalAnchors(s,tni->docAnchors);
+    unmarshalMembers(s,tni->members);
+    m_tagFileNamespaces.append(tni);
+  }
+
+  // packages
+  count = unmarshalUInt(s);
+  for (i=0;i<count;i++)
+  {
+    TagPackageInfo *tpgi = new TagPackageInfo;
+    tpgi->name     = unmarshalQCString(s);
+    tpgi->filename = unmarshalQCString(s);
+    unmarshalAnchors(s,tpgi->docAnchors);
+    unmarshalMembers(s,tpgi->members);
+    unmarshalStringList(s,tpgi->classList);
+    m_tagFilePackages.append(tpgi);
+  }
+
+  // groups
+  count = unmarshalUInt(s);
+  for (i=0;i<count;i++)
+  {
+    TagGroupInfo *tgi = new TagGroupInfo;
+    tgi->name     = unmarshalQCString(s);
+    tgi->title    = unmarshalQCString(s);
+    tgi->filename = unmarshalQCString(s);
+    unmarshalAnchors(s,tgi->docAnchors);
+    unmarshalMembers(s,tgi->members);
+    unmarshalStringList(s,tgi->subgroupList);
+    unmarshalStringList(s,tgi->classList);
+    unmarshalStringList(s,tgi->namespaceList);
+    unmarshalStringList(s,tgi->fileList);
+    unmarshalStringList(s,tgi->pageList);
+    unmarshalStringList(s,tgi->dirList);
+    m_tagFileGroups.append(tgi);
+  }
+
+  // pages
+  count = unmarshalUInt(s);
+  for (i=0;i<count;i++)
+  {
+    TagPageInfo *tpi = new TagPageInfo;
+    tpi->name     = unmarshalQCString(s);
+    tpi->title    = unmarshalQCString(s);
+    tpi->filename = unmarshalQCString(s);
+    unmarshalAnchors(s,tpi->docAnchors);
+    m_tagFilePages.append(tpi);
+  }
+
+  // dirs
+  count = unmarshalUInt(s);
+  for (i=0;i<count;i++)
+  {
+    TagDirInfo *tdi = new TagDirInfo;
+    tdi->name     = unmarshalQCString(s);
+    tdi->filename = unmarshalQCString(s);
+    tdi->path     = unmarshalQCString(s);
+    unmarshalStringList(s,tdi->subdirList);
+    unmarshalStringList(s,tdi->fileList);
+    unmarshalAnchors(s,tdi->docAnchors);
+    m_tagFileDirs.append(tdi);
+  }
+}
+
+static QCString tagFileIndexName(const char *fullName)
+{
+  return QCString(fullName)+".idx";
+}
+
+/*! Returns the time stamp of file \a fi in seconds since the epoch */
+static int fileTimeStamp(const QFileInfo &fi)
+{
+  return QDateTime(QDate(1970,1,1)).secsTo(fi.lastModified());
+}
+
+/*! Tries to fill \a handler from the binary index belonging to tag file
+ *  \a fi. Returns FALSE if there is no index, or if it is out of date
+ *  or corrupted, in which case the tag file itself needs to be parsed.
+ */
+static bool readTagFileIndex(TagFileParser &handler,const QFileInfo &fi)
+{
+  QFile f(tagFileIndexName(fi.absFilePath().utf8()));
+  if (!f.open(IO_ReadOnly)) return FALSE;
+  BlockStorage block;
+  block.reset(f.size());
+  if (f.readBlock(block.data(),block.size())!=(int)block.size()) return FALSE;
+  if (unmarshalUInt(&block)!=(uint)TAGINDEX_MAGIC)    return FALSE;
+  if (unmarshalUInt(&block)!=TAGINDEX_VERSION)        return FALSE;
+  if (unmarshalUInt64(&block)!=(uint64)fi.size())     return FALSE;
+  if (unmarshalInt(&block)!=fileTimeStamp(fi))        return FALSE;
+  uint len = unmarshalUInt(&block);
+  uint sum = unmarshalUInt(&block);
+  if (len!=block.size()-block.pos() ||
+      blockChecksum(block.data()+block.pos(),len)!=sum)
+  {
+    return FALSE;
+  }
+  handler.readIndex(&block);
+  return TRUE;
+}
+
+void writeTagFileIndex(const char *fullName)
 {
   QFileInfo fi(fullName);
   if (!fi.exists()) return;
-  TagFileParser handler( fullName ); // tagName
+
+  // parse the tag file as it was written
+  TagFileParser handler( fullName );
   handler.setFileName(fullName);
   TagFileErrorHandler errorHandler;
   QFile xmlFile( fullName );
@@ -1536,10 +1967,46 @@ void parseTagFile(Entry *root,const char *fullName)
   QXmlSimpleReader reader;
   reader.setContentHandler( &handler );
   reader.setErrorHandler( &errorHandler );
-  reader.parse( source );
+  if (!reader.parse( source )) return;
+
+  BlockStorage data;
+  handler.writeIndex(&data);
+  BlockStorage block;
+  marshalUInt(&block,TAGINDEX_MAGIC);
+  marshalUInt(&block,TAGINDEX_VERSION);
+  marshalUInt64(&block,fi.size());
+  marshalInt(&block,fileTimeStamp(fi));
+  marshalUInt(&block,data.size());
+  marshalUInt(&block,blockChecksum(data.data(),data.size()));
+  block.write(data.data(),data.size());
+
+  QCString indexName = tagFileIndexName(fullName);
+  QFile f(indexName);
+  if (!f.open(IO_WriteOnly))
+  {
+    err("cannot open tag file index %s for writing\n",indexName.data());
+    return;
+  }
+  f.writeBlock(block.data(),block.size());
+}
+
+void parseTagFile(Entry *root,const char *fullName)
+{
+  QFileInfo fi(fullName);
+  if (!fi.exists()) return;
+  TagFileParser handler( fullName ); // tagName
+  handler.setFileName(fullName);
+  if (!readTagFileIndex(handler,fi))
+  {
+    TagFileErrorHandler errorHandler;
+    QFile xmlFile( fullName );
+    QXmlInputSource source( xmlFile );
+    QXmlSimpleReader reader;
+    reader.setContentHandler( &handler );
+    reader.setErrorHandler( &errorHandler );
+    reader.parse( source );
+  }
   handler.buildLists(root);
   handler.addIncludes();
   //handler.dump();
 }
-
-
@@ -22,5 +22,6 @@
 class Entry;
 
 void parseTagFile(Entry *root,const char *fullPathName);
+void writeTagFileIndex(const char *fullPathName);
 
 #endif
@@ -27,6 +27,7 @@
 #include <qdir.h>
 #include <qdatetime.h>
 #include <qcache.h>
+#include <qptrdict.h>
 
 #include "util.h"
 #include "message.h"
@@ -2616,6 +2617,24 @@ QCString yearToString()
 }
 
 //----------------------------------------------------------------------
+
+/** Distances computed by minClassDistance(), relative to the level at
+ *  which they were computed, indexed by class and then by base class.
+ *  Without it, diamond shaped hierarchies are walked once per path.
+ */
+static QPtrDict< QPtrDict<int> > g_classDistanceCache(1009);
+/** Marks a distance that is still being computed */
+static const int classDistanceBusy = -2;
+
+void clearClassDistanceCache()
+{
+  if (g_classDistanceCache.count()>0)
+  {
+    g_classDistanceCache.setAutoDelete(TRUE);
+    g_classDistanceCache.clear();
+  }
+}
+
 // recursive function that returns the number of branches in the 
 // inheritance tree that the base class `bcd' is below the class `cd'
 
@@ -2627,12 +2646,26 @@ int minClassDistance(const ClassDef *cd,const ClassDef *bcd,int level)
     bcd=bcd->categoryOf();
   }
   if (cd==bcd) return level; 
-  if (level==256)
+  QPtrDict<int> *distances = g_classDistanceCache.find((void*)cd);
+  int *dist = distances ? distances->find((void*)bcd) : 0;
+  if (level==256 || (dist && *dist==classDistanceBusy))
   {
     warn_uncond("class %s seem to have a recursive "
         "inheritance relation!\n",cd->name().data());
     return -1;
   }
+  if (dist) // computed before
+  {
+    return *dist<0 || *dist==maxInheritanceDepth ? *dist : level+*dist;
+  }
+  if (distances==0)
+  {
+    distances = new QPtrDict<int>(17);
+    distances->setAutoDelete(TRUE);
+    g_classDistanceCache.insert((void*)cd,distances);
+  }
+  dist = new int(classDistanceBusy);
+  distances->insert((void*)bcd,dist);
   int m=maxInheritanceDepth; 
   if (cd->baseClasses())
   {
@@ -2645,6 +2678,7 @@ int minClassDistance(const ClassDef *cd,const ClassDef *bcd,int level)
       if (m<0) break;
     }
   }
+  *dist = m<0 || m==maxInheritanceDepth ? m : m-level;
   return m;
 }
 
@@ -5888,12 +5922,17 @@ QCString convertToId(const char *s)
 QCString convertToXML(const char *s)
 {
   static GrowBuf growBuf;
+  static const EscapeCharTable special("<>&'\"",TRUE);
   growBuf.clear();
   if (s==0) return "";
   const char *p=s;
   char c;
-  while ((c=*p++))
+  for (;;)
   {
+    const char *q=special.skip(p); // copy characters that need no escaping in one go
+    if (q>p) growBuf.addStr(p,q-p);
+    if ((c=*q)==0) break;
+    p=q+1;
     switch (c)
     {
       case '<':  growBuf.addStr("&lt;");   break;
@@ -5901,12 +5940,7 @@ QCString convertToXML(const char *s)
       case '&':  growBuf.addStr("&amp;");  break;
       case '\'': growBuf.addStr("&apos;"); break; 
       case '"':  growBuf.addStr("&quot;"); break;
-      case  1: case  2: case  3: case  4: case  5: case  6: case  7: case  8:
-      case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18:
-      case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
-      case 27: case 28: case 29: case 30: case 31:
-        break; // skip invalid XML characters (see http://www.w3.org/TR/2000/REC-xml-20001006#NT-Char)
-      default:   growBuf.addChar(c);       break;
+      default:   break; // skip invalid XML characters (see http://www.w3.org/TR/2000/REC-xml-20001006#NT-Char)
     }
   }
   growBuf.addChar(0);
@@ -5917,13 +5951,18 @@ QCString convertToXML(const char *s)
 QCString convertToHtml(const char *s,bool keepEntities)
 {
   static GrowBuf growBuf;
+  static const EscapeCharTable special("<>&'\"");
   growBuf.clear();
   if (s==0) return "";
   growBuf.addStr(getHtmlDirEmbedingChar(getTextDirByConfig(s)));
   const char *p=s;
   char c;
-  while ((c=*p++))
+  for (;;)
   {
+    const char *q=special.skip(p); // copy characters that need no escaping in one go
+    if (q>p) growBuf.addStr(p,q-p);
+    if ((c=*q)==0) break;
+    p=q+1;
     switch (c)
     {
       case '<':  growBuf.addStr("&lt;");   break;
@@ -5954,7 +5993,6 @@ QCString convertToHtml(const char *s,bool keepEntities)
                  break;
       case '\'': growBuf.addStr("&#39;");  break; 
       case '"':  growBuf.addStr("&quot;"); break;
-      default:   growBuf.addChar(c);       break;
     }
   }
   growBuf.addChar(0);
@@ -5964,19 +6002,23 @@ QCString convertToHtml(const char *s,bool keepEntities)
 QCString convertToJSString(const char *s, bool applyTextDir)
 {
   static GrowBuf growBuf;
+  static const EscapeCharTable special("\"\\");
   growBuf.clear();
   if (s==0) return "";
   if (applyTextDir)
     growBuf.addStr(getJsDirEmbedingChar(getTextDirByConfig(s)));
   const char *p=s;
   char c;
-  while ((c=*p++))
+  for (;;)
   {
+    const char *q=special.skip(p); // copy characters that need no escaping in one go
+    if (q>p) growBuf.addStr(p,q-p);
+    if ((c=*q)==0) break;
+    p=q+1;
     switch (c)
     {
       case '"':  growBuf.addStr("\\\""); break;
       case '\\': growBuf.addStr("\\\\"); break;
-      default:   growBuf.addChar(c);   break;
     }
   }
   growBuf.addChar(0);
@@ -6707,7 +6749,10 @@ void addGroupListToTitle(OutputList &ol,Definition *d)
 void filterLatexString(FTextStream &t,const char *str,
     bool insideTabbing,bool insidePre,bool insideItem,bool keepSpaces)
 {
+  static const EscapeCharTable preSpecial("\\{}_&%#$^~ ");
   if (str==0) return;
+  QIODevice *dev = t.device();
+  if (dev==0) return;
   //if (strlen(str)<2) stackTrace();
   const unsigned char *p=(const unsigned char *)str;
   const unsigned char *q;
@@ -6716,6 +6761,27 @@ void filterLatexString(FTextStream &t,const char *str,
   unsigned char pc='\0';
   while (*p)
   {
+    // write runs of characters that are copied unchanged in one go
+    if (insidePre)
+    {
+      q=(const unsigned char *)preSpecial.skip((const char *)p);
+    }
+    else if (pc!='.') // after a '.' an identifier character may get a break hint
+    {
+      q=p;
+      while ((*q>='a' && *q<='z') || (*q>='0' && *q<='9') || *q>=0x80) q++;
+    }
+    else
+    {
+      q=p;
+    }
+    if (q>p)
+    {
+      dev->writeBlock((const char *)p,q-p);
+      pc=q[-1];
+      p=q;
+      continue;
+    }
     c=*p++;
 
     if (insidePre)
@@ -7437,12 +7503,12 @@ QCString parseCommentAsText(const Definition *scope,const MemberDef *md,
   QGString s;
   if (doc.isEmpty()) return s.data();
   FTextStream t(&s);
-  DocNode *root = validatingParseDoc(fileName,lineNr,
+  DocNode *root = validatingParseDocCached(fileName,lineNr,
       (Definition*)scope,(MemberDef*)md,doc,FALSE,FALSE);
   TextDocVisitor *visitor = new TextDocVisitor(t);
   root->accept(visitor);
   delete visitor;
-  delete root;
+  releaseParsedDoc(root);
   QCString result = convertCharEntitiesToUTF8(s.data());
   int i=0;
   int charCnt=0;
@@ -8188,75 +8254,6 @@ bool copyFile(const QCString &src,const QCString &dest)
   return TRUE;
 }
 
-/** Returns the section of text, in between a pair of markers. 
- *  Full lines are returned, excluding the lines on which the markers appear.
- *  \sa routine lineBlock
- */
-QCString extractBlock(const QCString text,const QCString marker)
-{
-  QCString result;
-  int p=0,i;
-  bool found=FALSE;
-
-  // find the character positions of the markers
-  int m1 = text.find(marker);
-  if (m1==-1) return result;
-  int m2 = text.find(marker,m1+marker.length());
-  if (m2==-1) return result;
-
-  // find start and end line positions for the markers
-  int l1=-1,l2=-1;
-  while (!found && (i=text.find('\n',p))!=-1)
-  {
-    found = (p<=m1 && m1<i); // found the line with the start marker
-    p=i+1;
-  }
-  l1=p;
-  int lp=i;
-  if (found)
-  {
-    while ((i=text.find('\n',p))!=-1)
-    {
-      if (p<=m2 && m2<i) // found the line with the end marker
-      {
-        l2=p;
-        break;
-      }
-      p=i+1;
-      lp=i;
-    }
-  }
-  if (l2==-1) // marker at last line without newline (see bug706874)
-  {
-    l2=lp;
-  }
-  //printf("text=[%s]\n",text.mid(l1,l2-l1).data());
-  return l2>l1 ? text.mid(l1,l2-l1) : QCString();
-}
-
-/** Returns the line number of the line following the line with the marker.
- *  \sa routine extractBlock
- */
-int lineBlock(const QCString text,const QCString marker)
-{
-  int result = 1;
-  int p=0,i;
-  bool found=FALSE;
-
-  // find the character positions of the first marker
-  int m1 = text.find(marker);
-  if (m1==-1) return result;
-
-  // find start line positions for the markers
-  while (!found && (i=text.find('\n',p))!=-1)
-  {
-    found = (p<=m1 && m1<i); // found the line with the start marker
-    p=i+1;
-    result++;
-  }
-  return result;
-}
-
 /** Returns a string representation of \a lang. */
 QCString langToString(SrcLangExt lang)
 {
@@ -113,6 +113,36 @@ class LetterToIndexMap : public SIntDict<T>
     }
 };
 
+/** @brief Table of the characters an escaping routine has to handle.
+ *
+ *  Allows the routine to skip over and copy the runs of characters in
+ *  between as a whole. The string terminator is always part of the table.
+ */
+class EscapeCharTable
+{
+  public:
+    EscapeCharTable(const char *chars,bool xmlControlChars=FALSE)
+    {
+      memset(m_special,0,sizeof(m_special));
+      m_special[0]=TRUE;
+      for (const char *p=chars;*p;p++) m_special[(uchar)*p]=TRUE;
+      if (xmlControlChars) // all control characters except tab and newline
+      {
+        for (int i=1;i<32;i++) m_special[i] = i!=9 && i!=10;
+      }
+    }
+    /** Returns TRUE if \a c is in the table */
+    bool contains(uchar c) const { return m_special[c]; }
+    /** Returns the first character at or after \a p that is in the table */
+    const char *skip(const char *p) const
+    {
+      while (!m_special[(uchar)*p]) p++;
+      return p;
+    }
+  private:
+    bool m_special[256];
+};
+
 //--------------------------------------------------------------------
 
 QCString langToString(SrcLangExt lang);
@@ -263,6 +293,7 @@ bool namespaceHasVisibleChild(NamespaceDef *nd,bool includeClasses);
 bool classVisibleInIndex(ClassDef *cd);
 
 int minClassDistance(const ClassDef *cd,const ClassDef *bcd,int level=0);
+void clearClassDistanceCache();
 Protection classInheritedProtectionLevel(ClassDef *cd,ClassDef *bcd,Protection prot=Public,int level=0);
 
 QCString convertNameToFile(const char *name,bool allowDots=FALSE,bool allowUnderscore=FALSE);
@@ -444,8 +475,6 @@ void writeColoredImgData(const char *dir,ColoredImgDataItem data[]);
 QCString replaceColorMarkers(const char *str);
 
 bool copyFile(const QCString &src,const QCString &dest);
-QCString extractBlock(const QCString text,const QCString marker);
-int lineBlock(const QCString text,const QCString marker);
 
 QCString correctURL(const QCString &url,const QCString &relPath);
 
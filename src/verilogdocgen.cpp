@@ -32,6 +32,7 @@
 #include "layout.h"
 #include "arguments.h"
 #include "qdir.h"
+#include <qptrdict.h>
 #include "util.h"
 // sets the member spec variable for global variables
 // needed for writing file declarations
@@ -39,11 +40,6 @@ static void setType(MemberList* ml);
 static void parseDefineConstruct(QCString&, MemberDef*,OutputList& ol);
 static void writeFunctionProto(OutputList& ol,const ArgumentList* al,const MemberDef* mdef);
 
-static QDict<MemberDef> variableDict(10007);
-
-static QDict<MemberDef> instPortDict(10007);
-static QDict<MemberDef> classPortDict(10007);
-
 
 static QDict<MemberDef> functionDict(5003);
 static QDict<MemberDef> globalMemDict(5003);
@@ -621,101 +617,72 @@ QCString VerilogDocGen::getClassTitle(const ClassDef* cdef)
 
 //-----------------< Code Parsing >------------------------------------------------
 
-static bool buildInst=false;
-
-void buildVariableDict(ClassDef *inst, ClassDef *cl)
-{
-   MemberList *instPort=NULL;
-   MemberList *classPort=NULL;
-
-    instPortDict.clear();
-    classPortDict.clear();
-
-    if(inst!=NULL)
-        instPort=inst->getMemberList(MemberListType_variableMembers);
-
-  if(cl!=NULL)
-   classPort=cl->getMemberList(MemberListType_variableMembers);
-
-
-    if(instPort)
-      {
-            MemberListIterator mnii(*instPort);
-            MemberDef *md;
-      for (mnii.toFirst();(md=mnii.current());++mnii){
-        //printf("\n Inst: %s %s %s",md->name().data(),md->getOutputFileBase().data(),md->getReference().data());
-         instPortDict.insert(md->name().data(),md);
-        }
-      }
-
-    if(classPort)
-      {
-             MemberListIterator mnii(*classPort);
-       MemberDef *md;
-       for (mnii.toFirst();(md=mnii.current());++mnii){
-      //   printf("\n Class: %s %s %s",md->name().data(),md->getOutputFileBase().data(),md->getReference().data());
-         classPortDict.insert(md->name().data(),md);
-         }
-      }
-}//funct
-
-void buildVariableDict(ClassDef *cd)
+/*! Returns a dictionary of the variables and ports of \a cd, keyed by
+ *  name. The dictionary is built the first time it is requested for a
+ *  module and then kept for the rest of the run. The names are normalised
+ *  with adjustMemberName() before they are indexed; since that function
+ *  leaves an adjusted name unchanged, later calls to it elsewhere do not
+ *  invalidate the keys. If \a withMethods is TRUE the functions and tasks
+ *  of the module are included as well.
+ */
+static QDict<MemberDef> *getModuleMemberIndex(ClassDef *cd,bool withMethods)
 {
-
-if(cd==0) return;
-variableDict.clear();
-
-  MemberList* ml=cd->getMemberList(MemberListType_variableMembers);
-     if(ml)
-      {
-             MemberListIterator mnii(*ml);
-       MemberDef *md;
-             for (mnii.toFirst();(md=mnii.current());++mnii)
-             {
-               VerilogDocGen::adjustMemberName(md);
-                variableDict.insert(md->name().data(),md);
-              }
-     }
-
-     ml=cd->getMemberList(MemberListType_pubMethods);
-   if(ml)
-      {
-             MemberListIterator mnii(*ml);
-       MemberDef *md;
-             for (mnii.toFirst();(md=mnii.current());++mnii)
-                variableDict.insert(md->name().data(),md);
-     }
-}
-
-MemberDef* VerilogDocGen::findInstMember(QCString & cl,QCString & inst,QCString & key,bool b)
+  // module -> name -> member
+  static QPtrDict< QDict<MemberDef> > portIndex(1009);
+  static QPtrDict< QDict<MemberDef> > variableIndex(1009);
+
+  if (cd==0) return 0;
+  QPtrDict< QDict<MemberDef> > &index = withMethods ? variableIndex : portIndex;
+  QDict<MemberDef> *dict = index.find(cd);
+  if (dict) return dict;
+
+  MemberList *vars    = cd->getMemberList(MemberListType_variableMembers);
+  MemberList *methods = withMethods ? cd->getMemberList(MemberListType_pubMethods) : 0;
+  uint count = (vars ? vars->count() : 0) + (methods ? methods->count() : 0);
+  dict = new QDict<MemberDef>(count<8 ? 17 : count*2+1);
+  MemberDef *md;
+  if (vars)
   {
-     ClassDef* cdInst=0;
-   ClassDef* cdClass=0;
-   if(!cl.isEmpty())
-    cdClass= VhdlDocGen::getClass(cl.data());
-
-    if(!inst.isEmpty())
-     cdInst= VhdlDocGen::getClass(inst.data());
-
-    if(!buildInst)
+    MemberListIterator mnii(*vars);
+    for (mnii.toFirst();(md=mnii.current());++mnii)
     {
-         buildVariableDict(cdInst,cdClass);
-         buildInst=true;
+      VerilogDocGen::adjustMemberName(md);
+      dict->insert(md->name().data(),md);
     }
+  }
+  if (methods)
+  {
+    MemberListIterator mnii(*methods);
+    for (mnii.toFirst();(md=mnii.current());++mnii)
+    {
+      dict->insert(md->name().data(),md);
+    }
+  }
+  index.insert(cd,dict);
+  if (index.count()>index.size()*2) index.resize(index.size()*4+1);
+  return dict;
+}
 
-      if(!b)
-      return  classPortDict.find(key.data());
-    else
-      return  instPortDict.find(key.data());
-
-  }//find
+MemberDef* VerilogDocGen::findInstMember(QCString & cl,QCString & inst,QCString & key,bool b)
+{
+  ClassDef *cd = 0;
+  if (!b && !cl.isEmpty())
+  {
+    cd = VhdlDocGen::getClass(cl.data());
+  }
+  else if (b && !inst.isEmpty())
+  {
+    cd = VhdlDocGen::getClass(inst.data());
+  }
+  QDict<MemberDef> *ports = getModuleMemberIndex(cd,FALSE);
+  return ports ? ports->find(key.data()) : 0;
+}//find
 
 
 MemberDef* VerilogDocGen::findMember(QCString& className, QCString& memName,int type)
 {
   ClassDef* cd;
   MemberDef *mdef=NULL;
-    buildInst=false;
 
   cd= VhdlDocGen::getClass(className.data());
   //  if(!cd) return NULL;
@@ -739,10 +706,6 @@ MemberDef* VerilogDocGen::findMember(QCString& className, QCString& memName,int
  MemberDef* VerilogDocGen::findMemberDef(ClassDef* cd,const QCString& key,MemberListType type)
  {
 
-  static QCString className;
-  static QCString prevName;
-  static ClassDef* sClass=0;
-
   MemberDef  *mem=NULL;
 
   if(cd==0)
@@ -751,16 +714,8 @@ MemberDef* VerilogDocGen::findMember(QCString& className, QCString& memName,int
     if(mem) return mem;
     return NULL;
   }
-  className=cd->name();
 
-  if(prevName != className )
-  {
-    prevName=className;
-    buildVariableDict(cd);
-  }
-
-  if(mem==0)
-    mem=variableDict.find(key.data());
+  mem=getModuleMemberIndex(cd,TRUE)->find(key.data());
 
   if(mem)
   {
@@ -878,6 +833,44 @@ MemberDef *md;
   }//findMemberNameSdict
 */
 
+static bool isUndocumentedSignal(const Entry *e)
+{
+  if (e->section!=Entry::VARIABLE_SEC) return FALSE;
+  if (e->spec!=VerilogDocGen::SIGNAL &&
+      e->spec!=VerilogDocGen::PORT &&
+      e->spec!=VerilogDocGen::PARAMETER) return FALSE;
+  return e->brief.stripWhiteSpace().isEmpty() &&
+         e->doc.stripWhiteSpace().isEmpty() &&
+         e->inbodyDocs.stripWhiteSpace().isEmpty() &&
+         e->groups->isEmpty();
+}
+
+void VerilogDocGen::removeUndocumentedSignals(Entry *root)
+{
+  static bool hideUndocSignals = Config_getBool(HIDE_UNDOC_SIGNALS);
+  if (!hideUndocSignals || root==0) return;
+
+  QList<Entry> undocumented;
+  EntryListIterator eli(*root->children());
+  Entry *e;
+  for (;(e=eli.current());++eli)
+  {
+    if (isUndocumentedSignal(e))
+    {
+      undocumented.append(e);
+    }
+    else
+    {
+      removeUndocumentedSignals(e);
+    }
+  }
+  QListIterator<Entry> uli(undocumented);
+  for (;(e=uli.current());++uli)
+  {
+    delete root->removeSubEntry(e);
+  }
+}
+
 void VerilogDocGen::initEntry(Entry *e)
 {
   e->fileName +=getVerilogParsingFile();
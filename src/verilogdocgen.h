@@ -129,6 +129,8 @@ static Entry* getEntryAtLine(const Entry* ce,int line);
 static QList<Entry>* getEntryAtLine1(const Entry* ce,int line);
 static void buildGlobalVerilogVariableDict(const FileDef* fileDef,bool clear=FALSE,int level=0);
 static MemberDef* findInstMember(QCString& cl,QCString& inst,QCString& key,bool b);
+// removes the undocumented ports, signals and parameters below root
+static void removeUndocumentedSignals(Entry *root);
 static QCString findFile(const char *fileName);
 };
 
@@ -28,6 +28,7 @@
 #include <qfileinfo.h>
 #include <qstringlist.h>
 #include <qmap.h>
+#include <qptrdict.h>
 
 /* --------------------------------------------------------------- */
 
@@ -72,7 +73,8 @@ static QDict<QCString> g_vhdlKeyDict3(17,FALSE);
 
 static void initUCF(Entry* root,const char* type,QCString &  qcs,int line,QCString & fileName,QCString & brief);
 void writeUCFLink(const MemberDef* mdef,OutputList &ol);
-static void assignBinding(VhdlConfNode* conf);
+struct VhdlBindingIndex;
+static void assignBinding(VhdlConfNode* conf,const VhdlBindingIndex &index);
 static void addInstance(ClassDef* entity, ClassDef* arch, ClassDef *inst,Entry *cur,ClassDef* archBind=NULL);
 
 //---------- create svg -------------------------------------------------------------
@@ -712,10 +714,40 @@ ClassDef* VhdlDocGen::getPackageName(const QCString & name)
   return cd;
 }
 
-static QMap<QCString,MemberDef*> varMap;
-static QList<ClassDef> qli;
 static QMap<ClassDef*,QList<ClassDef> > packages;
 
+/** Case-insensitive index of all classes (design units) by name.
+ *  Rebuilt when classes are added, as it is used while they are built.
+ */
+static QDict<ClassDef> *g_vhdlClassIndex=0;
+static uint             g_vhdlClassIndexCount=0;
+
+/** Case-insensitive index of the members of a member list, per list */
+static QPtrDict< QDict<MemberDef> > g_vhdlMemberIndex(257);
+
+static QDict<ClassDef> *getVhdlClassIndex()
+{
+  uint count=Doxygen::classSDict->count();
+  if (g_vhdlClassIndex && g_vhdlClassIndexCount==count)
+  {
+    return g_vhdlClassIndex;
+  }
+  delete g_vhdlClassIndex;
+  g_vhdlClassIndex=new QDict<ClassDef>(QMAX(count*2+1,257),FALSE);
+  g_vhdlClassIndexCount=count;
+  ClassSDict::Iterator cli(*Doxygen::classSDict);
+  ClassDef *cd;
+  for (;(cd=cli.current());++cli)
+  {
+    // keep the first class in case names only differ in case
+    if (g_vhdlClassIndex->find(cd->name())==0)
+    {
+      g_vhdlClassIndex->insert(cd->name(),cd);
+    }
+  }
+  return g_vhdlClassIndex;
+}
+
 MemberDef* VhdlDocGen::findMember(const QCString& className, const QCString& memName)
 {
   ClassDef* cd,*ecd;
@@ -740,17 +772,7 @@ MemberDef* VhdlDocGen::findMember(const QCString& className, const QCString& mem
     // searching upper/lower case names
 
     QCString tt=d->name();
-    ecd =getClass(tt);
-    if (!ecd)
-    {
-      tt=tt.upper();
-      ecd =getClass(tt);
-    }
-    if (!ecd)
-    {
-      tt=tt.lower();
-      ecd =getClass(tt);
-    }
+    ecd =findVhdlClass(tt);
 
     if (ecd) //d && d->definitionType()==Definition::TypeClass)
     {
@@ -769,17 +791,7 @@ MemberDef* VhdlDocGen::findMember(const QCString& className, const QCString& mem
     Definition *d = cd->getOuterScope();
 
     QCString tt=d->name();
-    ClassDef *ecd =getClass(tt);
-    if (!ecd)
-    {
-      tt=tt.upper();
-      ecd =getClass(tt);
-    }
-    if (!ecd)
-    {
-      tt=tt.lower();
-      ecd =getClass(tt);
-    }
+    ClassDef *ecd =findVhdlClass(tt);
     if (ecd) //d && d->definitionType()==Definition::TypeClass)
     {
       if(!packages.contains(ecd))
@@ -816,53 +828,28 @@ MemberDef* VhdlDocGen::findMember(const QCString& className, const QCString& mem
  */
 MemberDef* VhdlDocGen::findMemberDef(ClassDef* cd,const QCString& key,MemberListType type)
 {
-  MemberDef *md=0;
-  MemberList *ml=0;
-  QCString keyType=cd->symbolName()+"@"+key;
-  //printf("\n %s | %s | %s",cd->symbolName().data(),key.data(,),keyType.data());
-
-  QMap<QCString, MemberDef*>::Iterator it =varMap.find(keyType);
-  if (it.key())
-  {
-    md=it.data();
-    if (md)
-    {
-      return md;
-    }
-  }
-  if (qli.contains(cd))
-  {
-    return 0;
-  }
-  ml=cd->getMemberList(type);
-  qli.append(cd);
+  if (key.isEmpty()) return 0;
+  MemberList *ml=cd->getMemberList(type);
   if (!ml)
   {
     return 0;
   }
-  MemberListIterator fmni(*ml);
-  //int l=ml->count();
-  //	fprintf(stderr,"\n loading entity %s %s: %d",cd->symbolName().data(),keyType.data(),l);
-
-  for (fmni.toFirst();(md=fmni.current());++fmni)
+  QDict<MemberDef> *dict=g_vhdlMemberIndex.find(ml);
+  if (dict==0)
   {
-    QCString tkey=cd->symbolName()+"@"+md->name();
-    if (varMap.contains(tkey))
+    dict=new QDict<MemberDef>(QMAX(ml->count()*2+1,17),FALSE);
+    MemberListIterator fmni(*ml);
+    MemberDef *md;
+    for (fmni.toFirst();(md=fmni.current());++fmni)
     {
-      continue;
-    }
-    varMap.insert(tkey.data(),md);
-  }
-  it=varMap.find(keyType.data());
-  if (it.key())
-  {
-    md=it.data();
-    if (md)
-    {
-      return md;
+      if (dict->find(md->name())==0)
+      {
+        dict->insert(md->name(),md);
+      }
     }
+    g_vhdlMemberIndex.insert(ml,dict);
   }
-  return 0;
+  return dict->find(key);
 }//findMemberDef
 
 /*!
@@ -3064,17 +3051,8 @@ QCString  VhdlDocGen::parseForBinding(QCString & entity,QCString & arch)
  // find class with upper/lower letters
  ClassDef* VhdlDocGen::findVhdlClass(const char *className )
  {
-
-  ClassSDict::Iterator cli(*Doxygen::classSDict);
-  ClassDef *cd;
-  for (;(cd=cli.current());++cli)
-  {
-    if (qstricmp(className,cd->name().data())==0)
-    {
-      return cd;
-    }
-  }
-  return 0;
+  if (className==0 || className[0]=='\0') return 0;
+  return getVhdlClassIndex()->find(className);
  }
 
 
@@ -3087,11 +3065,24 @@ QCString  VhdlDocGen::parseForBinding(QCString & entity,QCString & arch)
 //@param isInlineConf
 //@param confN List of configurations
 
-void assignBinding(VhdlConfNode * conf)
+/** Lookup tables for binding configurations to component instances,
+ *  built once by computeVhdlComponentRelations().
+ */
+struct VhdlBindingIndex
+{
+  VhdlBindingIndex(int confSize,int instSize)
+    : configurations(confSize), instances(instSize,FALSE)
+  {
+    instances.setAutoDelete(TRUE);
+  }
+  QDict<VhdlConfNode>  configurations; // configuration name -> configuration
+  QDict< QList<Entry> > instances;     // instance label (any case) -> instances
+  QList<Entry>         unlabelled;     // instances without a label
+  QList<Entry>         all;            // all instances in order
+};
+
+void assignBinding(VhdlConfNode * conf,const VhdlBindingIndex &index)
 {
-  QList<Entry> instList=getVhdlInstList();
-  QListIterator<Entry> eli(instList);
-  Entry *cur=0;
   ClassDef *archClass=0,*entClass=0;
   QCString archName;
   QCString arcBind,entBind;
@@ -3102,24 +3093,15 @@ void assignBinding(VhdlConfNode * conf)
 
   if (qstricmp(conf2,"configuration")==0)
   {
-    QList<VhdlConfNode> confList =  getVhdlConfiguration();
-    VhdlConfNode* vconf;
-    //  bool found=false;
-    for (uint iter=0;iter<confList.count(); iter++)
+    VhdlConfNode* vconf=index.configurations.find(entBind);
+    if (vconf)
     {
-      vconf= (VhdlConfNode *)confList.at(iter);
-      QCString n=VhdlDocGen::getIndexWord(vconf->confVhdl.data(),0);
-      if (n==entBind)
-      {
-        // found=true;
-        entBind=VhdlDocGen::getIndexWord(vconf->confVhdl.data(),1);
-        QCString a=VhdlDocGen::getIndexWord(conf->compSpec.data(),0);
-        QCString e=VhdlDocGen::getIndexWord(conf->confVhdl.data(),1);
-        a=e+"::"+a;
-        archClass= VhdlDocGen::findVhdlClass(a.data());//Doxygen::classSDict->find(a.data());
-        entClass= VhdlDocGen::findVhdlClass(e.data());//Doxygen::classSDict->find(e.data());
-        break;
-      }
+      entBind=VhdlDocGen::getIndexWord(vconf->confVhdl.data(),1);
+      QCString a=VhdlDocGen::getIndexWord(conf->compSpec.data(),0);
+      QCString e=VhdlDocGen::getIndexWord(conf->confVhdl.data(),1);
+      a=e+"::"+a;
+      archClass= VhdlDocGen::findVhdlClass(a.data());//Doxygen::classSDict->find(a.data());
+      entClass= VhdlDocGen::findVhdlClass(e.data());//Doxygen::classSDict->find(e.data());
     }
   }
   else  // conf2!=configuration
@@ -3140,9 +3122,6 @@ void assignBinding(VhdlConfNode * conf)
     entClass= VhdlDocGen::findVhdlClass(e.data()); //Doxygen::classSDict->find(e.data());
   }
 
-  QCString label=conf->compSpec.lower();
-  //label.prepend("|");
-
   if (!archClass)
   {
  //   err("architecture %s not found ! ",conf->confVhdl.data());
@@ -3154,56 +3133,67 @@ void assignBinding(VhdlConfNode * conf)
   all=allOt.lower()=="all" ;
   others= allOt.lower()=="others";
 
-  for (;(cur=eli.current());++eli)
+  // the instances this configuration can bind to
+  const QList<Entry> *instList=&index.all;
+  if (!conf->isInlineConf)
   {
-    if (cur->exception.lower()==label || conf->isInlineConf)
+    if (conf->compSpec.isEmpty())
     {
-      QCString archy;
+      instList=&index.unlabelled;
+    }
+    else
+    {
+      instList=index.instances.find(conf->compSpec);
+    }
+    if (instList==0) return;
+  }
+
+  // everything below only depends on the configuration, not on the instance
+  QCString archy;
+  if (all || others)
+  {
+    archy=VhdlDocGen::getIndexWord(conf->arch.data(),1);
+  }
+  else
+  {
+    archy=conf->arch;
+  }
+  QCString	  inst1=VhdlDocGen::getIndexWord(archy.data(),0).lower();
+  QCString	  comp=VhdlDocGen::getIndexWord(archy.data(),1).lower();
+  QStringList ql=QStringList::split(",",inst1);
+  ClassDef *ent= VhdlDocGen::findVhdlClass(entBind.data());//Doxygen::classSDict->find(entBind.data());
 
+  QListIterator<Entry> eli(*instList);
+  Entry *cur=0;
+  for (;(cur=eli.current());++eli)
+  {
+    for (uint j=0;j<ql.count();j++)
+    {
+      QCString archy1,sign1;
       if (all || others)
       {
-        archy=VhdlDocGen::getIndexWord(conf->arch.data(),1);
+        archy1=archy;
+        sign1=cur->type;
       }
       else
       {
-        archy=conf->arch;
+        archy1=comp+":"+ql[j].utf8();
+        sign1=cur->type+":"+cur->name;
       }
 
-      QCString	  inst1=VhdlDocGen::getIndexWord(archy.data(),0).lower();
-      QCString	  comp=VhdlDocGen::getIndexWord(archy.data(),1).lower();
-
-      QStringList ql=QStringList::split(",",inst1);
-
-      for (uint j=0;j<ql.count();j++)
+      if (archy1==sign1.lower() && !cur->stat)
       {
-        QCString archy1,sign1;
-        if (all || others)
+        // fprintf(stderr," \n label [%s] [%s] [%s]",cur->exception.data(),cur->type.data(),cur->name.data());
+        if (entClass==0 || ent==0)
         {
-          archy1=VhdlDocGen::getIndexWord(conf->arch.data(),1);
-          sign1=cur->type;
-        }
-        else
-        {
-          archy1=comp+":"+ql[j].utf8();
-          sign1=cur->type+":"+cur->name;
+          continue;
         }
 
-        if (archy1==sign1.lower() && !cur->stat)
-        {
-          // fprintf(stderr," \n label [%s] [%s] [%s]",cur->exception.data(),cur->type.data(),cur->name.data());
-          ClassDef *ent= VhdlDocGen::findVhdlClass(entBind.data());//Doxygen::classSDict->find(entBind.data());
-
-          if (entClass==0 || ent==0)
-          {
-            continue;
-          }
-
-          addInstance(ent,archClass,entClass,cur);
-          cur->stat=TRUE;
-          break;
-        }
-      }// for
-    }
+        addInstance(ent,archClass,entClass,cur);
+        cur->stat=TRUE;
+        break;
+      }
+    }// for
   }//for each element in instList
 
 }//assignBinding
@@ -3225,7 +3215,40 @@ void VhdlDocGen::computeVhdlComponentRelations()
 {
 
   QCString entity,arch,inst;
-  QList<VhdlConfNode> confList =  getVhdlConfiguration();
+  QList<VhdlConfNode> &confList =  getVhdlConfiguration();
+  QList<Entry> &qsl= getVhdlInstList();
+  QListIterator<Entry> eli(qsl);
+  Entry *cur;
+
+  // index configurations and instances once, instead of scanning them for each configuration
+  VhdlBindingIndex index(QMAX(confList.count()*2+1,257),QMAX(qsl.count()*2+1,257));
+  for (uint iter=0;iter<confList.count(); iter++)
+  {
+    VhdlConfNode* conf= (VhdlConfNode *)confList.at(iter);
+    QCString n=VhdlDocGen::getIndexWord(conf->confVhdl.data(),0);
+    if (!n.isEmpty() && index.configurations.find(n)==0)
+    {
+      index.configurations.insert(n,conf);
+    }
+  }
+  for (eli.toFirst();(cur=eli.current());++eli)
+  {
+    index.all.append(cur);
+    if (cur->exception.isEmpty())
+    {
+      index.unlabelled.append(cur);
+    }
+    else
+    {
+      QList<Entry> *l=index.instances.find(cur->exception);
+      if (l==0)
+      {
+        l=new QList<Entry>;
+        index.instances.insert(cur->exception,l);
+      }
+      l->append(cur);
+    }
+  }
 
   for (uint iter=0;iter<confList.count(); iter++)
   {
@@ -3234,13 +3257,9 @@ void VhdlDocGen::computeVhdlComponentRelations()
     {
       continue;
     }
-    assignBinding(conf);
+    assignBinding(conf,index);
   }
 
-  QList<Entry> qsl= getVhdlInstList();
-  QListIterator<Entry> eli(qsl);
-  Entry *cur;
-
   for (eli.toFirst();(cur=eli.current());++eli)
   {
     if (cur->stat ) //  was bind
@@ -3521,8 +3540,11 @@ void VhdlDocGen::createFlowChart(const MemberDef *mdef)
 
 void VhdlDocGen::resetCodeVhdlParserState()
 {
-  varMap.clear();
-  qli.clear();
+  g_vhdlMemberIndex.setAutoDelete(TRUE);
+  g_vhdlMemberIndex.clear();
+  delete g_vhdlClassIndex;
+  g_vhdlClassIndex=0;
+  g_vhdlClassIndexCount=0;
   packages.clear();
 }
 
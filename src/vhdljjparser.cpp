@@ -196,6 +196,18 @@ void VHDLLanguageScanner::parseInput(const char *fileName,const char *fileBuf,En
   VhdlParser::lastEntity=0;
   VhdlParser::currentCompound=0;
   VhdlParser::lastEntity=0;
+  // do not let state left behind by a syntax error in the previous file leak into this one
+  VhdlParser::tempEntry=0;
+  VhdlParser::compSpec.resize(0);
+  VhdlParser::currName.resize(0);
+  VhdlParser::confName.resize(0);
+  VhdlParser::genLabels.resize(0);
+  VhdlParser::lab.resize(0);
+  VhdlParser::forL.resize(0);
+  VhdlParser::param_sec=0;
+  VhdlParser::parse_sec=0;
+  VhdlParser::currP=0;
+  VhdlParser::levelCounter=0;
   oldEntry = 0;
   VhdlParser::current=new Entry();
   VhdlParser::initEntry(VhdlParser::current);
@@ -326,7 +326,7 @@ void XmlDocVisitor::visit(DocInclude *inc)
       Doxygen::parserManager->getParser(inc->extension())
                             ->parseCode(m_ci,
                                         inc->context(),
-                                        extractBlock(inc->text(),inc->blockId()),
+                                        inc->blockText(),
                                         langExt,
                                         inc->isExample(),
                                         inc->exampleFile()
@@ -341,12 +341,12 @@ void XmlDocVisitor::visit(DocInclude *inc)
          Doxygen::parserManager->getParser(inc->extension())
                                ->parseCode(m_ci,
                                            inc->context(),
-                                           extractBlock(inc->text(),inc->blockId()),
+                                           inc->blockText(),
                                            langExt,
                                            inc->isExample(),
                                            inc->exampleFile(), 
                                            &fd,
-                                           lineBlock(inc->text(),inc->blockId()),
+                                           inc->blockLine(),
                                            -1,    // endLine
                                            FALSE, // inlineFragment
                                            0,     // memberDef
@@ -1081,7 +1081,7 @@ void XmlDocVisitor::visitPost(DocParBlock *)
 
 void XmlDocVisitor::filter(const char *str)
 { 
-  m_t << convertToXML(str);
+  writeXMLString(m_t,str);
 }
 
 void XmlDocVisitor::startLink(const QCString &ref,const QCString &file,const QCString &anchor)
@@ -47,6 +47,7 @@
 #include "section.h"
 #include "htmlentity.h"
 #include "resourcemgr.h"
+#include "outputmanifest.h"
 
 // no debug info
 #define XML_DB(x) do {} while(0)
@@ -106,9 +107,35 @@ class XmlSectionMapper : public QIntDict<char>
 static XmlSectionMapper g_xmlSectionMapper;
 
 
-inline void writeXMLString(FTextStream &t,const char *s)
+/*! Writes \a s to \a t with the XML special characters escaped, using the
+ *  same character table as convertToXML(). Runs of characters that need no
+ *  escaping are written directly to the stream's device, avoiding an
+ *  intermediate copy of the string.
+ */
+void writeXMLString(FTextStream &t,const char *s)
 {
-  t << convertToXML(s);
+  static const EscapeCharTable special("<>&'\"",TRUE);
+  if (s==0) return;
+  QIODevice *dev = t.device();
+  if (dev==0) return;
+  const char *p=s;
+  char c;
+  for (;;)
+  {
+    const char *q=special.skip(p); // write characters that need no escaping in one go
+    if (q>p) dev->writeBlock(p,q-p);
+    if ((c=*q)==0) break;
+    p=q+1;
+    switch (c)
+    {
+      case '<':  dev->writeBlock("&lt;",4);   break;
+      case '>':  dev->writeBlock("&gt;",4);   break;
+      case '&':  dev->writeBlock("&amp;",5);  break;
+      case '\'': dev->writeBlock("&apos;",6); break;
+      case '"':  dev->writeBlock("&quot;",6); break;
+      default:   break; // skip invalid XML characters
+    }
+  }
 }
 
 inline void writeXMLCodeString(FTextStream &t,const char *s, int &col)
@@ -157,7 +184,7 @@ static void writeCombineScript()
 {
   QCString outputDirectory = Config_getString(XML_OUTPUT);
   QCString fileName=outputDirectory+"/combine.xslt";
-  QFile f(fileName);
+  ManifestFile f(fileName);
   if (!f.open(IO_WriteOnly))
   {
     err("Cannot open file %s for writing!\n",fileName.data());
@@ -432,7 +459,7 @@ static void writeXMLDocBlock(FTextStream &t,
   QCString stext = text.stripWhiteSpace();
   if (stext.isEmpty()) return;
   // convert the documentation string into an abstract syntax tree
-  DocNode *root = validatingParseDoc(fileName,lineNr,scope,md,text,FALSE,FALSE);
+  DocNode *root = validatingParseDocCached(fileName,lineNr,scope,md,text,FALSE,FALSE);
   // create a code generator
   XMLCodeGenerator *xmlCodeGen = new XMLCodeGenerator(t);
   // create a parse tree visitor for XML
@@ -442,7 +469,7 @@ static void writeXMLDocBlock(FTextStream &t,
   // clean up
   delete visitor;
   delete xmlCodeGen;
-  delete root;
+  releaseParsedDoc(root);
   
 }
 
@@ -1265,7 +1292,7 @@ static void generateXMLForClass(ClassDef *cd,FTextStream &ti)
   
   QCString outputDirectory = Config_getString(XML_OUTPUT);
   QCString fileName=outputDirectory+"/"+ classOutputFileBase(cd)+".xml";
-  QFile f(fileName);
+  ManifestFile f(fileName);
   if (!f.open(IO_WriteOnly))
   {
     err("Cannot open file %s for writing!\n",fileName.data());
@@ -1465,7 +1492,7 @@ static void generateXMLForNamespace(NamespaceDef *nd,FTextStream &ti)
   
   QCString outputDirectory = Config_getString(XML_OUTPUT);
   QCString fileName=outputDirectory+"/"+nd->getOutputFileBase()+".xml";
-  QFile f(fileName);
+  ManifestFile f(fileName);
   if (!f.open(IO_WriteOnly))
   {
     err("Cannot open file %s for writing!\n",fileName.data());
@@ -1546,7 +1573,7 @@ static void generateXMLForFile(FileDef *fd,FTextStream &ti)
   
   QCString outputDirectory = Config_getString(XML_OUTPUT);
   QCString fileName=outputDirectory+"/"+fd->getOutputFileBase()+".xml";
-  QFile f(fileName);
+  ManifestFile f(fileName);
   if (!f.open(IO_WriteOnly))
   {
     err("Cannot open file %s for writing!\n",fileName.data());
@@ -1683,7 +1710,7 @@ static void generateXMLForGroup(GroupDef *gd,FTextStream &ti)
   
   QCString outputDirectory = Config_getString(XML_OUTPUT);
   QCString fileName=outputDirectory+"/"+gd->getOutputFileBase()+".xml";
-  QFile f(fileName);
+  ManifestFile f(fileName);
   if (!f.open(IO_WriteOnly))
   {
     err("Cannot open file %s for writing!\n",fileName.data());
@@ -1746,7 +1773,7 @@ static void generateXMLForDir(DirDef *dd,FTextStream &ti)
 
   QCString outputDirectory = Config_getString(XML_OUTPUT);
   QCString fileName=outputDirectory+"/"+dd->getOutputFileBase()+".xml";
-  QFile f(fileName);
+  ManifestFile f(fileName);
   if (!f.open(IO_WriteOnly))
   {
     err("Cannot open file %s for writing!\n",fileName.data());
@@ -1799,7 +1826,7 @@ static void generateXMLForPage(PageDef *pd,FTextStream &ti,bool isExample)
   
   QCString outputDirectory = Config_getString(XML_OUTPUT);
   QCString fileName=outputDirectory+"/"+pageName+".xml";
-  QFile f(fileName);
+  ManifestFile f(fileName);
   if (!f.open(IO_WriteOnly))
   {
     err("Cannot open file %s for writing!\n",fileName.data());
@@ -1880,7 +1907,7 @@ void generateXML()
   ResourceMgr::instance().copyResource("index.xsd",outputDirectory);
 
   QCString fileName=outputDirectory+"/compound.xsd";
-  QFile f(fileName);
+  ManifestFile f(fileName);
   if (!f.open(IO_WriteOnly))
   {
     err("Cannot open file %s for writing!\n",fileName.data());
@@ -15,6 +15,9 @@
 #ifndef XMLGEN_H
 #define XMLGEN_H
 
+class FTextStream;
+
 void generateXML();
+void writeXMLString(FTextStream &t,const char *s);
 
 #endif
@@ -0,0 +1,235 @@
+#!/usr/bin/python
+
+from __future__ import print_function
+import argparse, os, re, shutil, sys, time
+
+try:
+	import resource
+except ImportError: # not available on Windows
+	resource = None
+
+phase_reg = re.compile('Spent\s+(?P<secs>[0-9.]+)\s+seconds in\s+(?P<phase>.*)$')
+
+# scale factors for the different kinds of input, relative to --scale 1
+SIZES = {
+	'cpp_files'        : 20,  # number of C++ headers
+	'cpp_classes'      : 10,  # classes per C++ header
+	'cpp_members'      : 12,  # members per C++ class
+	'verilog_files'    : 50,  # number of Verilog files
+	'verilog_modules'  : 20,  # modules per Verilog file
+	'verilog_ports'    : 8,   # ports per Verilog module
+	'verilog_depth'    : 6,   # depth of the instantiation tree
+	'vhdl_files'       : 20,  # number of VHDL files
+	'vhdl_entities'    : 5,   # entities per VHDL file
+	'vhdl_ports'       : 8,   # ports per VHDL entity
+	'md_pages'         : 20,  # number of markdown pages
+	'md_sections'      : 10,  # sections per markdown page
+}
+
+class Generator:
+	"""Writes a synthetic project of a configurable size"""
+	def __init__(self,outdir,scale):
+		self.outdir   = outdir
+		self.scale    = scale
+		self.files    = 0
+		self.members  = 0
+
+	def count(self,kind):
+		return max(1,int(SIZES[kind]*self.scale))
+
+	def open(self,name):
+		self.files = self.files + 1
+		return open(os.path.join(self.outdir,name),'w')
+
+	def gen_cpp(self):
+		num_files = self.count('cpp_files')
+		for f_idx in range(num_files):
+			with self.open('cpp_%05d.h' % f_idx) as f:
+				print('/** @file\n *  Synthetic C++ header %d.\n */' % f_idx,file=f)
+				if f_idx>0:
+					print('#include "cpp_%05d.h"' % (f_idx-1),file=f)
+				print('namespace ns%d {' % (f_idx%10),file=f)
+				for c_idx in range(self.count('cpp_classes')):
+					name = 'Class_%d_%d' % (f_idx,c_idx)
+					if c_idx>0:
+						base = ' : public Class_%d_%d' % (f_idx,c_idx-1)
+					elif f_idx>0:
+						base = ' : public ns%d::Class_%d_0' % ((f_idx-1)%10,f_idx-1)
+					else:
+						base = ''
+					print('/** Brief description of %s.\n *\n *  Detailed description with a '
+					      'reference to #%s::method0.\n */' % (name,name),file=f)
+					print('class %s%s\n{\n  public:' % (name,base),file=f)
+					for m_idx in range(self.count('cpp_members')):
+						print('    /** Method %d of %s.\n     *  @param a first value\n'
+						      '     *  @param b second value\n     *  @returns the sum\n     */' % (m_idx,name),file=f)
+						print('    virtual int method%d(int a,const char *b);' % m_idx,file=f)
+						print('    int member%d; //!< data member %d' % (m_idx,m_idx),file=f)
+						self.members = self.members + 2
+					print('};',file=f)
+				print('}',file=f)
+
+	def gen_verilog(self):
+		num_files   = self.count('verilog_files')
+		num_modules = self.count('verilog_modules')
+		num_ports   = self.count('verilog_ports')
+		depth       = self.count('verilog_depth')
+		for f_idx in range(num_files):
+			with self.open('rtl_%05d.v' % f_idx) as f:
+				for m_idx in range(num_modules):
+					name = 'mod_%d_%d' % (f_idx,m_idx)
+					ports = ['clk','rst_n'] + ['d%d' % p for p in range(num_ports)]
+					print('//% @brief Synthetic module ' + name,file=f)
+					print('//%% Level %d of the instantiation tree.' % (m_idx%depth),file=f)
+					print('module %s (%s);' % (name,', '.join(ports)),file=f)
+					print('  input clk; //% clock',file=f)
+					print('  input rst_n; //% active low reset',file=f)
+					for p in range(num_ports):
+						direction = 'input' if p%2==0 else 'output'
+						print('  %s [%d:0] d%d; //%% data port %d' % (direction,p+7,p,p),file=f)
+					print('  wire [31:0] w0;',file=f)
+					print('  reg  [31:0] r0;',file=f)
+					self.members = self.members + len(ports) + 2
+					# instantiate the next level of the tree (if any)
+					if (m_idx%depth)<depth-1 and m_idx+1<num_modules:
+						child = 'mod_%d_%d' % (f_idx,m_idx+1)
+						for i_idx in range(2):
+							conns = ', '.join(['.%s(%s)' % (p,p) for p in ports])
+							print('  %s u_%s_%d (%s);' % (child,child,i_idx,conns),file=f)
+							self.members = self.members + 1
+					print('  always @(posedge clk) r0 <= w0;',file=f)
+					print('endmodule\n',file=f)
+
+	def gen_vhdl(self):
+		num_files    = self.count('vhdl_files')
+		num_entities = self.count('vhdl_entities')
+		num_ports    = self.count('vhdl_ports')
+		for f_idx in range(num_files):
+			with self.open('vhdl_%05d.vhd' % f_idx) as f:
+				print('library ieee;\nuse ieee.std_logic_1164.all;\n',file=f)
+				for e_idx in range(num_entities):
+					name = 'ent_%d_%d' % (f_idx,e_idx)
+					print('--! @brief Synthetic entity %s' % name,file=f)
+					print('entity %s is\n  port (' % name,file=f)
+					print('    clk : in std_logic; --! clock',file=f)
+					for p in range(num_ports):
+						direction = 'in' if p%2==0 else 'out'
+						sep = ';' if p<num_ports-1 else ''
+						print('    p%d : %s std_logic_vector(%d downto 0)%s --! port %d' % (p,direction,p+7,sep,p),file=f)
+					print('  );\nend entity %s;\n' % name,file=f)
+					print('--! @brief RTL architecture of %s' % name,file=f)
+					print('architecture rtl of %s is' % name,file=f)
+					print('  signal s0 : std_logic; --! internal signal',file=f)
+					print('begin',file=f)
+					print('  proc : process(clk)\n  begin\n  end process;',file=f)
+					print('end architecture rtl;\n',file=f)
+					self.members = self.members + num_ports + 3
+
+	def gen_markdown(self):
+		num_pages    = self.count('md_pages')
+		num_sections = self.count('md_sections')
+		for p_idx in range(num_pages):
+			with self.open('page_%05d.md' % p_idx) as f:
+				print('Synthetic page %d {#page_%d}\n===========\n' % (p_idx,p_idx),file=f)
+				for s_idx in range(num_sections):
+					print('Section %d.%d {#sec_%d_%d}\n-----------\n' % (p_idx,s_idx,p_idx,s_idx),file=f)
+					print('Some *emphasized* text and `code` with a [link](@ref page_%d).\n' % ((p_idx+1)%num_pages),file=f)
+					print('- item one\n- item two\n  1. nested\n  2. list\n',file=f)
+					print('| A | B |\n|---|---|\n| %d | %d |\n' % (p_idx,s_idx),file=f)
+					print('    int code_block_%d_%d = 0;\n' % (p_idx,s_idx),file=f)
+
+	def generate(self,kinds):
+		shutil.rmtree(self.outdir,ignore_errors=True)
+		os.makedirs(self.outdir)
+		if 'cpp' in kinds:
+			self.gen_cpp()
+		if 'verilog' in kinds:
+			self.gen_verilog()
+		if 'vhdl' in kinds:
+			self.gen_vhdl()
+		if 'markdown' in kinds:
+			self.gen_markdown()
+
+class Benchmark:
+	def __init__(self,args):
+		self.args   = args
+		self.srcdir = os.path.join(args.outputdir,'bench_input')
+		self.outdir = os.path.join(args.outputdir,'bench_output')
+		self.gen    = Generator(self.srcdir,args.scale)
+
+	def write_config(self):
+		shutil.rmtree(self.outdir,ignore_errors=True)
+		os.makedirs(self.outdir)
+		cfg = os.path.join(self.outdir,'Doxyfile')
+		with open(cfg,'w') as f:
+			print('QUIET = NO',file=f)
+			print('WARNINGS = NO',file=f)
+			print('WARN_IF_UNDOCUMENTED = NO',file=f)
+			print('EXTRACT_ALL = YES',file=f)
+			print('INPUT = %s' % self.srcdir,file=f)
+			print('OUTPUT_DIRECTORY = %s' % self.outdir,file=f)
+			print('FILE_PATTERNS = *.h *.v *.vhd *.md',file=f)
+			print('HAVE_DOT = NO',file=f)
+			for fmt in ['HTML','LATEX','XML','RTF','MAN','DOCBOOK']:
+				print('GENERATE_%s = %s' % (fmt,'YES' if fmt.lower() in self.args.formats else 'NO'),file=f)
+			for option in self.args.config or []:
+				print(option,file=f)
+		return cfg
+
+	def run(self):
+		print('Generating synthetic project (scale %s) in %s' % (self.args.scale,self.srcdir))
+		self.gen.generate(self.args.kinds)
+		cfg = self.write_config()
+		log = os.path.join(self.outdir,'doxygen.log')
+		start = time.time()
+		status = os.system('%s -d time %s > %s 2>&1' % (self.args.doxygen,cfg,log))
+		elapsed = time.time() - start
+		if status!=0:
+			print('Error: failed to run %s on %s, see %s' % (self.args.doxygen,cfg,log))
+			return 1
+		phases = []
+		with open(log,'r') as f:
+			for line in f.readlines():
+				m = phase_reg.search(line.rstrip())
+				if m:
+					phases.append((float(m.group('secs')),m.group('phase').strip()))
+		print('-------------------------------------')
+		if self.args.phases:
+			for (secs,phase) in phases:
+				print('%8.3f sec  %s' % (secs,phase))
+			print('-------------------------------------')
+		print('input files     : %d' % self.gen.files)
+		print('input members   : %d' % self.gen.members)
+		print('elapsed time    : %.3f sec' % elapsed)
+		if elapsed>0:
+			print('files/sec       : %.1f' % (self.gen.files/elapsed))
+			print('members/sec     : %.1f' % (self.gen.members/elapsed))
+		if resource:
+			maxrss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+			if sys.platform=='darwin': # reported in bytes instead of kilobytes
+				maxrss = maxrss/1024
+			print('peak memory     : %.1f MB' % (maxrss/1024.0))
+		if not self.args.keep:
+			shutil.rmtree(self.srcdir,ignore_errors=True)
+			shutil.rmtree(self.outdir,ignore_errors=True)
+		return 0
+
+def main():
+	# argument handling
+	parser = argparse.ArgumentParser(description='run doxygen on a synthetic project and report its throughput')
+	parser.add_argument('--doxygen',nargs='?',default='doxygen',help='path/name of the doxygen executable')
+	parser.add_argument('--outputdir',nargs='?',default='.',help='directory to write the synthetic project and its output to')
+	parser.add_argument('--scale',nargs='?',default=1.0,type=float,help='size of the generated project relative to the default (1.0)')
+	parser.add_argument('--kinds',nargs='+',default=['cpp','verilog','vhdl','markdown'],
+	                    choices=['cpp','verilog','vhdl','markdown'],help='kinds of input to generate')
+	parser.add_argument('--formats',nargs='+',default=['html','xml'],
+	                    choices=['html','latex','xml','rtf','man','docbook'],help='output formats to generate')
+	parser.add_argument('--config',nargs='+',help='additional Doxyfile lines, e.g. "SOURCE_BROWSER=YES"')
+	parser.add_argument('--phases',help='show the time spent in each doxygen phase',action="store_true")
+	parser.add_argument('--keep',help='keep the generated input and output',action="store_true")
+	args = parser.parse_args()
+
+	sys.exit(Benchmark(args).run())
+
+if __name__ == '__main__':
+	main()
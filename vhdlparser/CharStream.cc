@@ -5,8 +5,8 @@
 namespace {
 template <class T>
 void ArrayCopy(T* src, int src_offset, T* dest, int dest_offset, int len) {
- for (int i = 0; i < len; i++) {
-   dest[dest_offset + i] = src[src_offset + i];
+ if (len > 0) {
+   memcpy(dest + dest_offset, src + src_offset, len * sizeof(T));
  }
 }
 
@@ -29,6 +29,28 @@ class StringReaderStream : public ReaderStream {
   size_t cur_;
   size_t max_;
 };
+
+// Reads directly from a buffer owned by the caller, without taking a copy.
+class BufferReaderStream : public ReaderStream {
+ public:
+  BufferReaderStream(const JAVACC_CHAR_TYPE *buf, size_t sz) : buf_(buf), cur_(0), max_(sz) {}
+  virtual size_t read(JAVACC_CHAR_TYPE *bufptr, int offset, size_t len) {
+    size_t count = len > max_ ? max_ : len;
+    memcpy(bufptr + offset, buf_ + cur_, count * sizeof(JAVACC_CHAR_TYPE));
+    cur_ += count;
+    max_ -= count;
+    return count;
+  }
+  virtual ~BufferReaderStream() {}
+  virtual bool endOfInput() {
+    return max_ == 0;
+  }
+
+ private:
+  const JAVACC_CHAR_TYPE *buf_;
+  size_t cur_;
+  size_t max_;
+};
 }
 
 namespace vhdl {
@@ -40,6 +62,13 @@ void CharStream::ReInit(const JAVACC_STRING_TYPE& str, int startline,
   deleteStream = true;
 }
 
+void CharStream::ReInit(const JAVACC_CHAR_TYPE *buf, int sz, int startline,
+                        int startcolumn, int buffersize) {
+  BufferReaderStream *stream = new BufferReaderStream(buf, sz);
+  ReInit(stream, startline, startcolumn, buffersize);
+  deleteStream = true;
+}
+
 void CharStream::ReInit(ReaderStream *input_stream, int startline,
                         int startcolumn, int buffersize) {
   if (deleteStream) {
@@ -111,9 +140,11 @@ void CharStream::adjustBeginLineColumn(int newLine, int newCol) {
 }
 
 void CharStream::ExpandBuff(bool wrapAround) {
-  JAVACC_CHAR_TYPE *newbuffer = new JAVACC_CHAR_TYPE[bufsize + 2048];
-  int *newbufline = new int[bufsize + 2048];
-  int *newbufcolumn = new int[bufsize + 2048];
+  // grow geometrically, so long tokens (e.g. comments) are not copied over and over
+  int grow = MAX(bufsize, 2048);
+  JAVACC_CHAR_TYPE *newbuffer = new JAVACC_CHAR_TYPE[bufsize + grow];
+  int *newbufline = new int[bufsize + grow];
+  int *newbufcolumn = new int[bufsize + grow];
 
   if (wrapAround) {
     ArrayCopy(buffer, tokenBegin, newbuffer, 0, bufsize - tokenBegin);
@@ -135,7 +166,7 @@ void CharStream::ExpandBuff(bool wrapAround) {
   buffer = newbuffer;
   bufline = newbufline;
   bufcolumn = newbufcolumn;
-  bufsize += 2048;
+  bufsize += grow;
   available = bufsize;
   tokenBegin = 0;
 }
@@ -154,7 +154,7 @@ virtual inline JAVACC_CHAR_TYPE readChar() {
     buffer(NULL), bufpos(0), bufsize(0), tokenBegin(0), column(0), line(0),
     prevCharIsCR (false), prevCharIsLF (false), available(0), maxNextCharInd(0),
     inBuf(0),tabSize(8), trackLineColumn(true) {
-    ReInit(JAVACC_STRING_TYPE(buf, sz), startline, startcolumn, buffersize);
+    ReInit(buf, sz, startline, startcolumn, buffersize);
   }
 
   CharStream(const JAVACC_CHAR_TYPE *buf, int sz, int startline, int startcolumn) :
@@ -162,7 +162,7 @@ virtual inline JAVACC_CHAR_TYPE readChar() {
     buffer(NULL), bufpos(0), bufsize(0), tokenBegin(0), column(0), line(0),
     prevCharIsCR (false), prevCharIsLF (false), available(0), maxNextCharInd(0),
     inBuf(0),tabSize(8), trackLineColumn(true) {
-    ReInit(JAVACC_STRING_TYPE(buf, sz), startline, startcolumn, INITIAL_BUFFER_SIZE);
+    ReInit(buf, sz, startline, startcolumn, INITIAL_BUFFER_SIZE);
   }
 
   CharStream(const JAVACC_STRING_TYPE& str, int startline,
@@ -222,6 +222,13 @@ virtual inline JAVACC_CHAR_TYPE readChar() {
   virtual void ReInit(const JAVACC_STRING_TYPE& str, int startline,
                       int startcolumn, int buffersize);
 
+  /**
+   * Reads from the \a sz characters at \a buf without copying them first,
+   * the buffer must stay valid for the lifetime of the stream.
+   */
+  virtual void ReInit(const JAVACC_CHAR_TYPE *buf, int sz, int startline,
+                      int startcolumn, int buffersize);
+
   virtual void ReInit(const JAVACC_STRING_TYPE& str, int startline,
                       int startcolumn) {
     ReInit(str, startline, startcolumn, INITIAL_BUFFER_SIZE);
@@ -8968,7 +8968,7 @@ static  QCString popLabel(QCString & q);
 static  bool addLibUseClause(const QCString &type);
 static  void mapLibPackage( Entry* root);
 static void createFlow();
-static void error_skipto(int kind);
+void error_skipto(int kind);
 static void oneLineComment(QCString qcs);
 static void setMultCommentLine();private: bool jj_done;
 
@@ -7,14 +7,15 @@
 
 using namespace vhdl::parser;
 
-static VhdlParser * myParser=0;
-
+/* Each call owns its own stream, token manager and parser, no
+ * parser instance is kept between files.
+ */
 void  VhdlParserIF::parseVhdlfile(const char* inputBuffer,bool inLine) 
 {
-  JAVACC_STRING_TYPE s =inputBuffer;
-  CharStream *stream = new CharStream(s.c_str(), (int)s.size(), 1, 1);
+  // the stream reads from inputBuffer directly, it stays valid until we return
+  CharStream *stream = new CharStream(inputBuffer, (int)strlen(inputBuffer), 1, 1);
   VhdlParserTokenManager *tokenManager = new VhdlParserTokenManager(stream);
-  myParser=new VhdlParser(tokenManager);
+  VhdlParser *myParser=new VhdlParser(tokenManager); // owns tokenManager (and stream)
   VhdlErrorHandler *myErr=new VhdlErrorHandler();
   myParser->setErrorHandler(myErr);
   try
@@ -41,12 +42,11 @@ void VhdlParser::error_skipto(int kind)
   Token *op;
   do
   {
-     Token *t = myParser->getNextToken();// step to next token
-	 op=myParser->getToken(1);           // get first token
+     getNextToken();          // step to next token
+     op=getToken(1);          // get first token
      if (op==0) break;
-    //fprintf(stderr,"\n %s",t->image.data());
   } while (op->kind != kind);
-  myParser->hasError=false;
+  hasError=false;
   // The above loop consumes tokens all the way up to a token of
   // "kind".  We use a do-while loop rather than a while because the
   // current token is the one immediately before the erroneous token